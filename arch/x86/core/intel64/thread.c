@@ -56,12 +56,30 @@ void arch_new_thread(struct k_thread *thread, k_thread_stack_t *stack,
 	thread->arch.rdx = (long) p2;
 	thread->arch.rcx = (long) p3;
 
+#ifndef CONFIG_X86_LAZY_FPU_SWITCH
+	/* With lazy switching, the FP/SSE state is initialized on first
+	 * use instead: see vector_7 in locore.S.
+	 */
 	x86_sse_init(thread);
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_FPU
+	thread->arch.fp_saves = 0U;
+	thread->arch.fp_traps = 0U;
+#endif
 
 	thread->arch.flags = X86_THREAD_FLAG_ALL;
 	thread->switch_handle = thread;
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_FPU
+void arch_thread_fpu_usage(struct k_thread *thread, uint32_t *saves,
+			   uint32_t *traps)
+{
+	*saves = thread->arch.fp_saves;
+	*traps = thread->arch.fp_traps;
+}
+#endif
+
 int arch_float_disable(struct k_thread *thread)
 {
 	/* x86-64 always has FP/SSE enabled so cannot be disabled */
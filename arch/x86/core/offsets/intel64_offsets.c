@@ -26,6 +26,10 @@ GEN_OFFSET_SYM(_thread_arch_t, r9);
 GEN_OFFSET_SYM(_thread_arch_t, r10);
 GEN_OFFSET_SYM(_thread_arch_t, r11);
 GEN_OFFSET_SYM(_thread_arch_t, sse);
+#ifdef CONFIG_SCHED_THREAD_USAGE_FPU
+GEN_OFFSET_SYM(_thread_arch_t, fp_saves);
+GEN_OFFSET_SYM(_thread_arch_t, fp_traps);
+#endif
 #ifdef CONFIG_USERSPACE
 GEN_OFFSET_SYM(_thread_arch_t, ss);
 GEN_OFFSET_SYM(_thread_arch_t, cs);
@@ -65,6 +65,12 @@
 #define _thread_offset_to_sse \
 	(___thread_t_arch_OFFSET + ___thread_arch_t_sse_OFFSET)
 
+#define _thread_offset_to_fp_saves \
+	(___thread_t_arch_OFFSET + ___thread_arch_t_fp_saves_OFFSET)
+
+#define _thread_offset_to_fp_traps \
+	(___thread_t_arch_OFFSET + ___thread_arch_t_fp_traps_OFFSET)
+
 #define _thread_offset_to_ss \
 	(___thread_t_arch_OFFSET + ___thread_arch_t_ss_OFFSET)
 
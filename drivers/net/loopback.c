@@ -82,6 +82,90 @@ int loopback_get_num_dropped_packets(void)
 
 #endif
 
+#ifdef CONFIG_NET_LOOPBACK_SIMULATE_DELAY
+static struct {
+	struct net_pkt *pkt;
+	int64_t due;
+} loopback_delay_queue[CONFIG_NET_LOOPBACK_DELAY_QUEUE_SIZE];
+static size_t loopback_delay_head;
+static size_t loopback_delay_count;
+static uint32_t loopback_delay_ms;
+static struct k_spinlock loopback_delay_lock;
+
+static void loopback_delay_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(loopback_delay_work, loopback_delay_handler);
+
+int loopback_set_packet_delay(uint32_t delay_ms)
+{
+	loopback_delay_ms = delay_ms;
+	return 0;
+}
+
+/* Receive the packets whose delay has elapsed */
+static void loopback_delay_handler(struct k_work *work)
+{
+	k_spinlock_key_t key;
+	struct net_pkt *pkt;
+	int64_t wait;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		key = k_spin_lock(&loopback_delay_lock);
+
+		if (loopback_delay_count == 0) {
+			k_spin_unlock(&loopback_delay_lock, key);
+			break;
+		}
+
+		wait = loopback_delay_queue[loopback_delay_head].due - k_uptime_get();
+		if (wait > 0) {
+			k_spin_unlock(&loopback_delay_lock, key);
+			k_work_schedule(&loopback_delay_work, K_MSEC(wait));
+			break;
+		}
+
+		pkt = loopback_delay_queue[loopback_delay_head].pkt;
+		loopback_delay_head = (loopback_delay_head + 1) %
+				      ARRAY_SIZE(loopback_delay_queue);
+		loopback_delay_count--;
+
+		k_spin_unlock(&loopback_delay_lock, key);
+
+		if (net_recv_data(net_pkt_iface(pkt), pkt) < 0) {
+			LOG_ERR("Data receive failed.");
+			net_pkt_unref(pkt);
+		}
+	}
+}
+
+static int loopback_delay_enqueue(struct net_pkt *pkt)
+{
+	k_spinlock_key_t key;
+	size_t tail;
+
+	key = k_spin_lock(&loopback_delay_lock);
+
+	if (loopback_delay_count == ARRAY_SIZE(loopback_delay_queue)) {
+		k_spin_unlock(&loopback_delay_lock, key);
+		return -ENOBUFS;
+	}
+
+	tail = (loopback_delay_head + loopback_delay_count) %
+	       ARRAY_SIZE(loopback_delay_queue);
+	loopback_delay_queue[tail].pkt = pkt;
+	loopback_delay_queue[tail].due = k_uptime_get() + loopback_delay_ms;
+	loopback_delay_count++;
+
+	k_spin_unlock(&loopback_delay_lock, key);
+
+	/* Does nothing if the queue head is already waiting */
+	k_work_schedule(&loopback_delay_work, K_MSEC(loopback_delay_ms));
+
+	return 0;
+}
+#endif
+
 static int loopback_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct net_pkt *cloned;
@@ -138,6 +222,18 @@ static int loopback_send(const struct device *dev, struct net_pkt *pkt)
 		goto out;
 	}
 
+#ifdef CONFIG_NET_LOOPBACK_SIMULATE_DELAY
+	if (loopback_delay_ms > 0) {
+		if (loopback_delay_enqueue(cloned) < 0) {
+			/* Queue full, the packet is lost on the link */
+			net_pkt_unref(cloned);
+		}
+
+		res = 0;
+		goto out;
+	}
+#endif
+
 	res = net_recv_data(net_pkt_iface(cloned), cloned);
 	if (res < 0) {
 		LOG_ERR("Data receive failed.");
@@ -7,6 +7,7 @@
 #define ZEPHYR_INCLUDE_ARCH_X86_INTEL64_THREAD_H_
 
 #define X86_THREAD_FLAG_ALL 0x01 /* _thread_arch.flags: entire state saved */
+#define X86_THREAD_FLAG_FP  0x02 /* _thread_arch.flags: has used FP/SSE (lazy) */
 
 /*
  * GDT selectors - these must agree with the GDT layout in locore.S.
@@ -144,6 +145,11 @@ struct _thread_arch {
 	uint64_t r9;
 	uint64_t r10;
 	uint64_t r11;
+#ifdef CONFIG_SCHED_THREAD_USAGE_FPU
+	/* FP/SSE state saves on preemption, and lazy FP/SSE traps */
+	uint32_t fp_saves;
+	uint32_t fp_traps;
+#endif
 	char __aligned(X86_FXSAVE_ALIGN) sse[X86_FXSAVE_SIZE];
 };
 
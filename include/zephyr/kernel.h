@@ -878,6 +878,48 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
  *
  */
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Run a thread as a constant bandwidth server
+ *
+ * Gives the thread a runtime budget to use in each period, both in
+ * the same units used by k_cycle_get_32().  The kernel then manages
+ * the thread's deadline, which orders it against other threads of the
+ * same static priority exactly as with k_thread_deadline_set():
+ *
+ * - When the thread becomes ready and cannot finish its remaining
+ *   budget before its current deadline without exceeding its
+ *   bandwidth, it gets a full budget and a deadline one period away.
+ * - Once it has run for its budget, it is throttled (not scheduled)
+ *   until its deadline.  Then its budget is replenished and its
+ *   deadline is pushed back by one period.
+ *
+ * The budget is enforced with a kernel timeout, so a thread may
+ * overrun it by up to one tick.  The overrun is taken from the next
+ * budget.
+ *
+ * A server is only admitted if the sum of budget / period over all
+ * servers stays within @kconfig{CONFIG_SCHED_DEADLINE_CBS_MAX_UTIL}.
+ * For the bound to guarantee that servers meet their deadlines, give
+ * all of them the same static priority, with no other thread at a
+ * higher or equal priority consuming significant CPU time.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_DEADLINE_CBS} in your
+ * project configuration.
+ *
+ * @param thread Thread to configure
+ * @param budget Runtime per period in cycles, or 0 to stop running the
+ *               thread as a server
+ * @param period Period in cycles, at least @p budget and less than 2^31
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid budget or period
+ * @retval -EBUSY The server was rejected by admission control
+ */
+__syscall int k_thread_cbs_set(k_tid_t thread, uint32_t budget,
+			       uint32_t period);
+#endif
 #endif
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -1840,7 +1882,7 @@ struct k_queue {
 	{ \
 	.data_q = SYS_SFLIST_STATIC_INIT(&obj.data_q), \
 	.lock = { }, \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q),	\
+	.wait_q = Z_WAIT_Q_INIT_LOCKED(&obj.wait_q, &obj.lock),	\
 	_POLL_EVENT_OBJ_INIT(obj)		\
 	}
 
@@ -2206,7 +2248,7 @@ struct k_event {
 
 #define Z_EVENT_INITIALIZER(obj) \
 	{ \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.wait_q = Z_WAIT_Q_INIT_LOCKED(&obj.wait_q, &obj.lock), \
 	.events = 0 \
 	}
 
@@ -2853,6 +2895,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_pool;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3063,6 +3106,9 @@ struct k_sem {
 	_wait_q_t wait_q;
 	unsigned int count;
 	unsigned int limit;
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	struct k_spinlock lock;
+#endif
 
 	_POLL_EVENT;
 
@@ -3072,7 +3118,7 @@ struct k_sem {
 
 #define Z_SEM_INITIALIZER(obj, initial_count, count_limit) \
 	{ \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.wait_q = Z_WAIT_Q_INIT_LOCKED(&obj.wait_q, &obj.lock), \
 	.count = initial_count, \
 	.limit = count_limit, \
 	_POLL_EVENT_OBJ_INIT(obj) \
@@ -3293,6 +3339,35 @@ static inline bool k_work_is_pending(const struct k_work *work);
 int k_work_submit_to_queue(struct k_work_q *queue,
 			   struct k_work *work);
 
+/** @brief Submit several work items to a queue.
+ *
+ * This is equivalent to calling k_work_submit_to_queue() for each item
+ * in order, except that the work lock is taken and the caller may be
+ * rescheduled only once for the whole batch.  This makes submitting
+ * bursts of small work items much cheaper.
+ *
+ * Items that are already queued are left alone.  Items that are
+ * cancelling, or that the queue rejects, are skipped.  As with
+ * k_work_submit_to_queue(), an item that is currently running is
+ * queued to the queue running it.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue on which the items should run.
+ * If NULL the queue from the most recent submission of each item will be
+ * used.
+ *
+ * @param works array of pointers to the work items.
+ *
+ * @param num_works number of entries in @p works.
+ *
+ * @return the number of items queued by this call, or if no item could
+ * be submitted, the error k_work_submit_to_queue() returned for the
+ * first item that failed.
+ */
+int k_work_submit_batch(struct k_work_q *queue,
+			struct k_work **works, size_t num_works);
+
 /** @brief Submit a work item to the system queue.
  *
  * @funcprops \isr_ok
@@ -3468,6 +3543,77 @@ int k_work_queue_drain(struct k_work_q *queue, bool plug);
  */
 int k_work_queue_unplug(struct k_work_q *queue);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief Start the worker threads of a work queue pool.
+ *
+ * Each worker is an ordinary work queue with its own thread and list
+ * of pending items.  Items are handed to an idle worker when one
+ * exists, and a worker that has no pending items steals the oldest
+ * item of a sibling, so one slow handler does not hold up the rest of
+ * the pool.
+ *
+ * A work item is only ever run by one worker at a time, and flushing or
+ * cancelling it behaves as for a single-threaded queue.  No ordering is
+ * guaranteed between items submitted to a pool.
+ *
+ * @param pool pointer to a pool defined with K_WORK_POOL_DEFINE().
+ *
+ * @param prio initial priority of the worker threads.
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required.
+ */
+void k_work_pool_start(struct k_work_pool *pool, int prio,
+		       const struct k_work_pool_config *cfg);
+
+/** @brief Submit a work item to a work queue pool.
+ *
+ * This behaves as k_work_submit_to_queue() with the queue chosen by the
+ * pool: an item submitted from a handler running on one of the pool's
+ * workers goes to that worker, otherwise it goes to an idle worker, or
+ * to the workers in turn if none is idle.  An item that is running is
+ * queued to the worker running it.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool.
+ *
+ * @param work pointer to the work item.
+ *
+ * @return as for k_work_submit_to_queue().
+ */
+int k_work_pool_submit(struct k_work_pool *pool, struct k_work *work);
+
+/** @brief Wait until all workers of a pool have drained.
+ *
+ * This is k_work_queue_drain() applied to every worker of the pool.
+ * All workers are plugged before the call waits on any of them, so
+ * work stealing stops at once and no worker takes new items while
+ * another is still draining.
+ *
+ * @param pool pointer to the pool.
+ *
+ * @param plug if true the pool will continue to block new submissions
+ * after all items have drained, until k_work_pool_unplug() is invoked.
+ *
+ * @retval 1 if call had to wait for the drain to complete
+ * @retval 0 if call did not have to wait
+ * @retval negative if wait was interrupted or failed
+ */
+int k_work_pool_drain(struct k_work_pool *pool, bool plug);
+
+/** @brief Release a work queue pool to accept new submissions.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool.
+ *
+ * @retval 0 if successfully unplugged
+ * @retval -EALREADY if the pool was not plugged.
+ */
+int k_work_pool_unplug(struct k_work_pool *pool);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /** @brief Initialize a delayable work structure.
  *
  * This must be invoked before scheduling a delayable work structure for the
@@ -3979,8 +4125,84 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Pool this queue is a worker of, or NULL. */
+	struct k_work_pool *pool;
+#endif
 };
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/** @brief A structure holding optional configuration items for a work
+ * queue pool.
+ *
+ * This structure, and values it references, are not retained by
+ * k_work_pool_start().
+ */
+struct k_work_pool_config {
+	/** Base name for the worker threads.
+	 *
+	 * Worker @c i is named "<name>.<i>".  If left null the threads
+	 * will not have a name.
+	 */
+	const char *name;
+
+	/** Control whether the worker threads should yield between
+	 * items, as k_work_queue_config::no_yield.
+	 */
+	bool no_yield;
+
+	/** Pin worker @c i to CPU <tt>i % arch_num_cpus()</tt>.
+	 *
+	 * Requires @kconfig{CONFIG_SCHED_CPU_MASK}, ignored otherwise.
+	 */
+	bool pin_cpus;
+};
+
+/** @brief A work queue served by several worker threads.
+ *
+ * Define with K_WORK_POOL_DEFINE().  All fields are private.
+ */
+struct k_work_pool {
+	/* Per-worker queues, num_queues entries. */
+	struct k_work_q *queues;
+
+	/* Base of the worker stack array and the distance between its
+	 * members.
+	 */
+	k_thread_stack_t *stacks;
+	size_t stack_size;
+	size_t stack_stride;
+
+	uint32_t num_queues;
+
+	/* Round-robin cursor used when no worker is idle. */
+	uint32_t next;
+};
+
+/**
+ * @brief Statically define a work queue pool.
+ *
+ * This defines the worker queues and stacks of the pool.  The pool
+ * must be started with k_work_pool_start() before use.
+ *
+ * @param name Name of the pool.
+ * @param num_workers Number of worker threads.
+ * @param stack_size Stack size of each worker thread, in bytes.
+ */
+#define K_WORK_POOL_DEFINE(name, num_workers, stack_size)		\
+	static K_THREAD_STACK_ARRAY_DEFINE(_k_work_pool_stacks_##name,	\
+					   num_workers, stack_size);	\
+	static struct k_work_q _k_work_pool_queues_##name[num_workers]; \
+	struct k_work_pool name = {					\
+		.queues = _k_work_pool_queues_##name,			\
+		.stacks = (k_thread_stack_t *)_k_work_pool_stacks_##name, \
+		.stack_size = (stack_size),				\
+		.stack_stride = K_THREAD_STACK_LEN(stack_size),		\
+		.num_queues = (num_workers),				\
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Provide the implementation for inline functions declared above */
 
 static inline bool k_work_is_pending(const struct k_work *work)
@@ -4388,7 +4610,7 @@ struct k_msgq {
 
 #define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
 	{ \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.wait_q = Z_WAIT_Q_INIT_LOCKED(&obj.wait_q, &obj.lock), \
 	.msg_size = q_msg_size, \
 	.max_msgs = q_max_msgs, \
 	.buffer_start = q_buffer, \
@@ -4544,6 +4766,70 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs consecutive messages from @a data
+ * to message queue @a msgq, taking the queue lock and rescheduling only
+ * once for the whole batch.  Messages are handed directly to waiting
+ * receivers first and the rest are copied into the ring buffer until it
+ * is full.
+ *
+ * The caller only waits if not even one message can be sent.  After
+ * that first message is accepted, as many of the remaining messages as
+ * fit are sent without waiting.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to an array of @a num_msgs messages.
+ * @param num_msgs Number of messages in @a data.
+ * @param timeout Waiting period to send the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent (at least 1) on success.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is zero.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			      uint32_t num_msgs, k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq in a "first in, first out" manner, taking the queue lock and
+ * rescheduling only once for the whole batch.  Each message removed
+ * makes room for one blocked sender, whose message is appended to the
+ * queue and may itself be received as part of the same batch.
+ *
+ * The caller only waits if the queue is empty.  After the first message
+ * is received, as many further messages as are queued are received
+ * without waiting.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of an area to hold up to @a num_msgs messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received (at least 1) on success.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is zero.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data,
+			      uint32_t num_msgs, k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4807,6 +5093,8 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         put_claimed;     /**< # bytes claimed for writing */
+	size_t         get_claimed;     /**< # bytes claimed for reading */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -4833,6 +5121,8 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.put_claimed = 0,                                           \
+	.get_claimed = 0,                                           \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers),       \
@@ -4956,6 +5246,9 @@ __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 /**
  * @brief Query the number of bytes that may be read from @a pipe.
  *
+ * Data claimed with k_pipe_get_claim() and not yet finished is not
+ * counted.
+ *
  * @param pipe Address of the pipe.
  *
  * @retval a number n such that 0 <= n <= @ref k_pipe.size; the
@@ -4966,6 +5259,9 @@ __syscall size_t k_pipe_read_avail(struct k_pipe *pipe);
 /**
  * @brief Query the number of bytes that may be written to @a pipe
  *
+ * Space claimed with k_pipe_put_claim() and not yet finished is not
+ * counted.
+ *
  * @param pipe Address of the pipe.
  *
  * @retval a number n such that 0 <= n <= @ref k_pipe.size; the
@@ -4998,12 +5294,109 @@ __syscall void k_pipe_flush(struct k_pipe *pipe);
  */
 __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 
+/**
+ * @brief Claim space in a pipe's buffer for writing in place.
+ *
+ * This routine gives the caller direct access to free space in the pipe's
+ * buffer, so data can be produced (formatted, DMA'd, ...) there without
+ * first going through a separate buffer and k_pipe_put(). Once written,
+ * the data must be committed with @ref k_pipe_put_finish.
+ *
+ * Successive claims before the finish call return consecutive areas. The
+ * returned size can be smaller than requested if the buffer is nearly
+ * full or the free space wraps around the end of the buffer. While any
+ * space is claimed, k_pipe_put() only hands data directly to waiting
+ * readers and otherwise waits.
+ *
+ * @warning
+ * Only one thread may hold a write claim on a pipe at a time. This routine
+ * is not available to user mode threads.
+ *
+ * @param[in]  pipe Address of the pipe.
+ * @param[out] data Set to the start of the claimed area.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Size of the claimed area, zero if the pipe is full or
+ *         unbuffered.
+ */
+size_t k_pipe_put_claim(struct k_pipe *pipe, unsigned char **data,
+			size_t size);
+
+/**
+ * @brief Commit data written to claimed pipe space.
+ *
+ * The first @a size bytes of the areas returned by preceding
+ * @ref k_pipe_put_claim calls become readable and any remaining claimed
+ * space is handed back. Waiting readers are served from the buffer and
+ * rescheduled as needed.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, possibly 0.
+ *
+ * @retval 0 Data committed.
+ * @retval -EINVAL @a size exceeds the claimed space.
+ */
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim data in a pipe's buffer for reading in place.
+ *
+ * This routine gives the caller direct access to data in the pipe's
+ * buffer, so it can be consumed without first being copied out by
+ * k_pipe_get(). Once consumed, the data must be released with
+ * @ref k_pipe_get_finish.
+ *
+ * Successive claims before the finish call return consecutive areas. The
+ * returned size can be smaller than requested if less data is buffered or
+ * the data wraps around the end of the buffer. Only buffered data can be
+ * claimed; data held by blocked writers enters the buffer as space is
+ * released. While any data is claimed, k_pipe_get() only takes data
+ * directly from waiting writers and otherwise waits.
+ *
+ * @warning
+ * Only one thread may hold a read claim on a pipe at a time. This routine
+ * is not available to user mode threads.
+ *
+ * @param[in]  pipe Address of the pipe.
+ * @param[out] data Set to the start of the claimed area.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Size of the claimed area, zero if the pipe's buffer is empty or
+ *         the pipe is unbuffered.
+ */
+size_t k_pipe_get_claim(struct k_pipe *pipe, unsigned char **data,
+			size_t size);
+
+/**
+ * @brief Release data read from claimed pipe space.
+ *
+ * The first @a size bytes of the areas returned by preceding
+ * @ref k_pipe_get_claim calls are removed from the pipe and the rest stay
+ * buffered. Waiting writers refill the freed space and are rescheduled as
+ * needed.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, possibly 0.
+ *
+ * @retval 0 Data released.
+ * @retval -EINVAL @a size exceeds the claimed data.
+ */
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+struct k_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	uint32_t count;
+	void *blocks[CONFIG_MEM_SLAB_CPU_CACHE_SIZE];
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5011,10 +5404,18 @@ struct k_mem_slab {
 	size_t block_size;
 	char *buffer;
 	char *free_list;
+	/* blocks taken off free_list, including those in cpu_cache */
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	struct k_mem_slab_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* allocations draining the caches or waiting, frees bypass the
+	 * caches while non-zero
+	 */
+	uint32_t cache_bypass;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 };
@@ -5167,7 +5568,17 @@ extern void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	uint32_t cached = 0U;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->cpu_cache[i].count;
+	}
+
+	return slab->num_used - cached;
+#else
 	return slab->num_used;
+#endif
 }
 
 /**
@@ -5202,7 +5613,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->num_blocks - slab->num_used;
+	return slab->num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5770,6 +6181,84 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Persistent poll set
+ *
+ * A poll set keeps its events registered with their objects between
+ * waits, so waiting on it costs time proportional to the number of
+ * events that became ready rather than to the number of events in it.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - events whose object signaled them since the last wait */
+	sys_dlist_t ready;
+
+	/** PRIVATE - threads waiting on the set */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set The poll set to initialize.
+ */
+extern void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event, initialized with k_poll_event_init(), stays registered with
+ * its object until it is removed with k_poll_set_remove().  It must not
+ * be passed to k_poll() or be part of another set meanwhile, and neither
+ * it nor its object may be freed before it is removed.
+ *
+ * @param set The poll set.
+ * @param event The event to add.
+ *
+ * @retval 0 The event was added.
+ * @retval -EBUSY The event is already being polled.
+ */
+extern int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set The poll set.
+ * @param event The event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event is not part of @a set.
+ */
+extern int k_poll_set_remove(struct k_poll_set *set,
+			     struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to become ready.
+ *
+ * On success, @a ready is filled with up to @a max_events ready events,
+ * whose state field tells what they are ready for.  Events are level
+ * triggered: an event whose condition still holds at the next wait, for
+ * example a semaphore that was not taken, is returned again.  When more
+ * events are ready than fit in @a ready, the ones returned are moved
+ * behind the others so that the next wait reports those first.
+ *
+ * Only the events whose objects signaled them since the previous wait
+ * are looked at, the others are not touched.
+ *
+ * @param set The poll set.
+ * @param ready Array receiving the ready events.
+ * @param max_events Number of entries in @a ready, at least one.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a ready, or -EAGAIN if none became
+ *         ready within @a timeout.
+ */
+extern int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+			   int max_events, k_timeout_t timeout);
+
 /**
  * @internal
  */
@@ -6003,6 +6492,23 @@ int k_thread_runtime_stats_get(k_tid_t thread,
  */
 int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats);
 
+/**
+ * @brief Get the run queue latency histogram of a thread
+ *
+ * Every time @a thread is made ready, or is switched out while still
+ * ready because it was preempted or yielded, and later switched in, the
+ * number of hardware cycles in between is added to a log2 histogram.
+ * This routine copies that histogram.
+ *
+ * Requires CONFIG_SCHED_RUNQ_LATENCY.
+ *
+ * @param thread ID of thread.
+ * @param stats Pointer to struct to copy the histogram into.
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int k_thread_runq_latency_get(k_tid_t thread,
+			      struct k_runq_latency_stats *stats);
+
 /**
  * @brief Enable gathering of runtime statistics for specified thread
  *
@@ -30,4 +30,22 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+/** Number of buckets in a run queue latency histogram */
+#define K_RUNQ_LATENCY_BUCKETS 32
+
+/**
+ * Histogram of the time threads spend ready before being switched in,
+ * after a wakeup or after being preempted or yielding, in hardware
+ * cycles.
+ */
+struct k_runq_latency_stats {
+	/**
+	 * Bucket i counts latencies of [2^i, 2^(i+1)) cycles; bucket 0
+	 * also counts latencies of 0 cycles.
+	 */
+	uint32_t  buckets[K_RUNQ_LATENCY_BUCKETS];
+	uint64_t  total;        /**< sum of all latencies in cycles */
+	uint32_t  max;          /**< longest latency in cycles */
+};
+
 #endif
@@ -54,6 +54,21 @@ struct _pipe_desc {
 	struct k_thread *thread;         /* Back pointer to pended thread */
 };
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Constant bandwidth server state, see k_thread_cbs_set() */
+struct _thread_cbs {
+	/* budget and period in cycles; budget is zero if not a server */
+	uint32_t budget;
+	uint32_t period;
+
+	/* budget left until the deadline, negative after an overrun */
+	int32_t remaining;
+
+	/* replenishment, while the thread is throttled */
+	struct _timeout timer;
+};
+#endif
+
 /* can be used for creating 'dummy' threads, e.g. for pending on objects */
 struct _thread_base {
 
@@ -105,6 +120,10 @@ struct _thread_base {
 	int prio_deadline;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	struct _thread_cbs cbs;
+#endif
+
 	uint32_t order_key;
 
 #ifdef CONFIG_SMP
@@ -119,6 +138,11 @@ struct _thread_base {
 
 #endif
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* CPU whose run queue holds the thread while it is queued */
+	uint8_t runq_cpu;
+#endif
+
 #ifdef CONFIG_SCHED_CPU_MASK
 	/* "May run on" bits for each CPU */
 	uint8_t cpu_mask;
@@ -141,6 +165,12 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif
+
+#ifdef CONFIG_SCHED_RUNQ_LATENCY
+	/* Cycle count when the thread was made ready, 0 if not waiting */
+	uint32_t ready_stamp;
+	struct k_runq_latency_stats runq_latency;
+#endif
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -224,6 +254,16 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_FPU
+	/*
+	 * Number of times the thread's floating point/SIMD registers were
+	 * saved on preemption, and number of traps taken to give it the FP
+	 * unit under a lazy switching policy. Always zero for CPUs.
+	 */
+	uint32_t fp_saves;
+	uint32_t fp_traps;
+#endif
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
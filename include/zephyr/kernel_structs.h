@@ -62,6 +62,9 @@ extern "C" {
 /* Thread is being aborted */
 #define _THREAD_ABORTING (BIT(5))
 
+/* Thread has used up its CBS budget for the current period */
+#define _THREAD_THROTTLED (BIT(6))
+
 /* Thread is present in the ready queue */
 #define _THREAD_QUEUED (BIT(7))
 
@@ -93,6 +96,16 @@ struct _ready_q {
 #elif defined(CONFIG_SCHED_MULTIQ)
 	struct _priq_mq runq;
 #endif
+
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* number of threads in runq, used for load balancing */
+	uint32_t nr_queued;
+
+	/* equal priority picks between this runq and another one, used to
+	 * take turns between them
+	 */
+	uint32_t nr_ties;
+#endif
 };
 
 typedef struct _ready_q _ready_q_t;
@@ -110,7 +123,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -162,7 +175,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -188,6 +201,11 @@ struct z_kernel {
 	/* Need to signal an IPI at the next scheduling point */
 	bool pending_ipi;
 #endif
+
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* Bit i set if the runq of CPU i is not empty */
+	uint32_t runq_busy;
+#endif
 };
 
 typedef struct z_kernel _kernel_t;
@@ -218,20 +236,44 @@ bool z_smp_cpu_mobile(void);
 
 typedef struct {
 	struct _priq_rb waitq;
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	struct k_spinlock *lock;
+#endif
 } _wait_q_t;
 
 extern bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
 
 #define Z_WAIT_Q_INIT(wait_q) { { { .lessthan_fn = z_priq_rb_lessthan } } }
 
+#define Z_WAIT_Q_INIT_LOCKED(wait_q, obj_lock) \
+	{ .waitq = { { .lessthan_fn = z_priq_rb_lessthan } } \
+	  Z_WAIT_Q_LOCK_INIT(obj_lock) }
+
 #else
 
 typedef struct {
 	sys_dlist_t waitq;
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	struct k_spinlock *lock;
+#endif
 } _wait_q_t;
 
 #define Z_WAIT_Q_INIT(wait_q) { SYS_DLIST_STATIC_INIT(&(wait_q)->waitq) }
 
+#define Z_WAIT_Q_INIT_LOCKED(wait_q, obj_lock) \
+	{ .waitq = SYS_DLIST_STATIC_INIT(&(wait_q)->waitq) \
+	  Z_WAIT_Q_LOCK_INIT(obj_lock) }
+
+#endif
+
+/* A wait queue initialized with Z_WAIT_Q_INIT_LOCKED() is protected by
+ * the given lock of its owning object rather than by the scheduler lock
+ * when CONFIG_WAITQ_OBJ_LOCK is enabled, see z_waitq_init_locked().
+ */
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+#define Z_WAIT_Q_LOCK_INIT(obj_lock) , .lock = (obj_lock)
+#else
+#define Z_WAIT_Q_LOCK_INIT(obj_lock)
 #endif
 
 /* kernel timeout record */
@@ -243,7 +285,10 @@ struct _timeout {
 	sys_dnode_t node;
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
-	/* Can't use k_ticks_t for header dependency reasons */
+	/* Can't use k_ticks_t for header dependency reasons.  Holds the
+	 * delta from the previous timeout with the list backend, and the
+	 * absolute expiry tick with the timing wheel backend.
+	 */
 	int64_t dticks;
 #else
 	int32_t dticks;
@@ -33,6 +33,21 @@ int loopback_set_packet_drop_ratio(float ratio);
 int loopback_get_num_dropped_packets(void);
 #endif
 
+#ifdef CONFIG_NET_LOOPBACK_SIMULATE_DELAY
+/**
+ * @brief Set the packet delay
+ *
+ * @details Every packet is held for this time before it is received.
+ * Packets that do not fit in the delay queue are dropped, which makes
+ * the interface behave like a link with a small bottleneck buffer.
+ *
+ * @param[in] delay_ms Delay in milliseconds, 0 to disable
+ *
+ * @return 0 on success, otherwise a negative integer.
+ */
+int loopback_set_packet_delay(uint32_t delay_ms);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
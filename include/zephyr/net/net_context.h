@@ -315,11 +315,19 @@ __net_socket struct net_context {
 		k_timeout_t sndtimeo;
 #endif
 #if defined(CONFIG_NET_CONTEXT_RCVBUF)
+#if defined(CONFIG_NET_TCP_WINDOW_SCALE)
+		uint32_t rcvbuf;
+#else
 		uint16_t rcvbuf;
 #endif
+#endif
 #if defined(CONFIG_NET_CONTEXT_SNDBUF)
+#if defined(CONFIG_NET_TCP_WINDOW_SCALE)
+		uint32_t sndbuf;
+#else
 		uint16_t sndbuf;
 #endif
+#endif
 #if defined(CONFIG_NET_CONTEXT_DSCP_ECN)
 		uint8_t dscp_ecn;
 #endif
@@ -286,6 +286,23 @@ struct net_stats_pm {
 };
 
 
+/**
+ * @brief Software segmentation and receive offload statistics
+ */
+struct net_stats_seg_offload {
+	/** Number of TCP super-segments split before L2. */
+	net_stats_t gso_pkts;
+
+	/** Number of segments the super-segments were split into. */
+	net_stats_t gso_segs;
+
+	/** Number of coalesced TCP packets passed to the IP layer. */
+	net_stats_t gro_pkts;
+
+	/** Number of received segments merged into coalesced packets. */
+	net_stats_t gro_segs;
+};
+
 /**
  * @brief All network statistics in one struct.
  */
@@ -369,6 +386,11 @@ struct net_stats {
 #if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
 	struct net_stats_pm pm;
 #endif
+
+#if defined(CONFIG_NET_STATISTICS_SEG_OFFLOAD)
+	/** Software segmentation and receive offload statistics */
+	struct net_stats_seg_offload seg_offload;
+#endif
 };
 
 /**
@@ -519,6 +541,7 @@ enum net_request_stats_cmd {
 	NET_REQUEST_STATS_CMD_GET_PPP,
 	NET_REQUEST_STATS_CMD_GET_PM,
 	NET_REQUEST_STATS_CMD_GET_WIFI,
+	NET_REQUEST_STATS_CMD_GET_SEG_OFFLOAD,
 };
 
 #define NET_REQUEST_STATS_GET_ALL				\
@@ -613,6 +636,13 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_PM);
 NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_WIFI);
 #endif /* CONFIG_NET_STATISTICS_WIFI */
 
+#if defined(CONFIG_NET_STATISTICS_SEG_OFFLOAD)
+#define NET_REQUEST_STATS_GET_SEG_OFFLOAD			\
+	(_NET_STATS_BASE | NET_REQUEST_STATS_CMD_GET_SEG_OFFLOAD)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_SEG_OFFLOAD);
+#endif /* CONFIG_NET_STATISTICS_SEG_OFFLOAD */
+
 /**
  * @}
  */
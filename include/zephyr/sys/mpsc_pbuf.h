@@ -240,6 +240,38 @@ const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer);
 void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 		    const union mpsc_pbuf_generic *packet);
 
+/** @brief Claim up to @p max pending packets.
+ *
+ * Equivalent to calling @ref mpsc_pbuf_claim until it returns null or
+ * @p max packets are claimed, but the buffer lock is taken only once.
+ * Packets are returned in the order they were committed.
+ *
+ * @param buffer Buffer.
+ *
+ * @param[out] packets Array where pointers to claimed packets are written.
+ *
+ * @param max Size of @p packets.
+ *
+ * @return Number of claimed packets.
+ */
+size_t mpsc_pbuf_claim_many(struct mpsc_pbuf_buffer *buffer,
+			    const union mpsc_pbuf_generic **packets,
+			    size_t max);
+
+/** @brief Free packets claimed with @ref mpsc_pbuf_claim_many.
+ *
+ * Equivalent to calling @ref mpsc_pbuf_free for each packet, in order, but
+ * the buffer lock is taken and waiting producers are signalled only once.
+ *
+ * @param buffer Buffer.
+ *
+ * @param packets Packets, in the order they were claimed.
+ *
+ * @param n Number of packets.
+ */
+void mpsc_pbuf_free_many(struct mpsc_pbuf_buffer *buffer,
+			 const union mpsc_pbuf_generic **packets, size_t n);
+
 /** @brief Check if there are any message pending.
  *
  * @param buffer Buffer.
@@ -62,6 +62,37 @@ static inline void ring_buf_internal_reset(struct ring_buf *buf, int32_t value)
 	buf->get_head = buf->get_tail = buf->get_base = value;
 }
 
+/**
+ * @brief Read an index owned by the other side of the ring buffer
+ *
+ * With @kconfig{CONFIG_RING_BUFFER_SPSC} this is an acquire load, so that
+ * data written (or read) by the other side before publishing the index
+ * is visible (or no longer in use) once the new index is seen.
+ */
+static inline int32_t ring_buf_internal_load(const int32_t *idx)
+{
+#ifdef CONFIG_RING_BUFFER_SPSC
+	return __atomic_load_n(idx, __ATOMIC_ACQUIRE);
+#else
+	return *idx;
+#endif
+}
+
+/**
+ * @brief Publish an index to the other side of the ring buffer
+ *
+ * With @kconfig{CONFIG_RING_BUFFER_SPSC} this is a release store, pairing
+ * with ring_buf_internal_load().
+ */
+static inline void ring_buf_internal_store(int32_t *idx, int32_t value)
+{
+#ifdef CONFIG_RING_BUFFER_SPSC
+	__atomic_store_n(idx, value, __ATOMIC_RELEASE);
+#else
+	*idx = value;
+#endif
+}
+
 /**
  * @brief Define and initialize a ring buffer for byte data.
  *
@@ -198,7 +229,7 @@ static inline void ring_buf_item_init(struct ring_buf *buf,
  */
 static inline bool ring_buf_is_empty(struct ring_buf *buf)
 {
-	return buf->get_head == buf->put_tail;
+	return buf->get_head == ring_buf_internal_load(&buf->put_tail);
 }
 
 /**
@@ -220,7 +251,7 @@ static inline void ring_buf_reset(struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_space_get(struct ring_buf *buf)
 {
-	return buf->size - (buf->put_head - buf->get_tail);
+	return buf->size - (buf->put_head - ring_buf_internal_load(&buf->get_tail));
 }
 
 /**
@@ -256,7 +287,7 @@ static inline uint32_t ring_buf_capacity_get(struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_size_get(struct ring_buf *buf)
 {
-	return buf->put_tail - buf->get_head;
+	return ring_buf_internal_load(&buf->put_tail) - buf->get_head;
 }
 
 /**
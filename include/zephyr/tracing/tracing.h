@@ -333,6 +333,38 @@
  */
 #define sys_port_trace_k_work_submit_to_queue_exit(queue, work, ret)
 
+/**
+ * @brief Trace submit several works to work queue call entry
+ * @param queue Work queue structure
+ * @param works Array of work structures
+ * @param num_works Number of entries in works
+ */
+#define sys_port_trace_k_work_submit_batch_enter(queue, works, num_works)
+
+/**
+ * @brief Trace submit several works to work queue call exit
+ * @param queue Work queue structure
+ * @param works Array of work structures
+ * @param num_works Number of entries in works
+ * @param ret Return value
+ */
+#define sys_port_trace_k_work_submit_batch_exit(queue, works, num_works, ret)
+
+/**
+ * @brief Trace submit work to work queue pool call entry
+ * @param pool Work queue pool structure
+ * @param work Work structure
+ */
+#define sys_port_trace_k_work_pool_submit_enter(pool, work)
+
+/**
+ * @brief Trace submit work to work queue pool call exit
+ * @param pool Work queue pool structure
+ * @param work Work structure
+ * @param ret Return value
+ */
+#define sys_port_trace_k_work_pool_submit_exit(pool, work, ret)
+
 /**
  * @brief Trace submit work to system work queue call entry
  * @param work Work structure
@@ -1419,6 +1451,50 @@
  */
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
 
+/**
+ * @brief Trace Message Queue batch put attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch put attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch put attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)
+
+/**
+ * @brief Trace Message Queue batch get attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch get attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch get attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)
+
 /**
  * @brief Trace Message Queue peek
  * @param msgq Message Queue object
@@ -30,9 +30,110 @@ static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack, CONFIG_DYNAMIC_THREAD_POOL_SIZ
 				   CONFIG_DYNAMIC_THREAD_STACK_SIZE);
 SYS_BITARRAY_DEFINE_STATIC(dynamic_ba, BA_SIZE);
 
+#if CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0
+/*
+ * Heap-allocated kernel stacks are remembered here while there is room.
+ * Freeing one of them only marks it idle, so that the next allocation of
+ * the same size can take it back without a trip through the heap.
+ */
+struct stack_cache_entry {
+	k_thread_stack_t *stack;
+	size_t size;
+	bool idle;
+};
+
+static struct stack_cache_entry stack_cache[CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE];
+static struct k_spinlock stack_cache_lock;
+
+static k_thread_stack_t *stack_cache_get(size_t size)
+{
+	k_thread_stack_t *stack = NULL;
+
+	K_SPINLOCK(&stack_cache_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(stack_cache); i++) {
+			struct stack_cache_entry *entry = &stack_cache[i];
+
+			if (entry->idle && (entry->size == size)) {
+				entry->idle = false;
+				stack = entry->stack;
+				break;
+			}
+		}
+	}
+
+	return stack;
+}
+
+/* Start tracking a newly allocated stack, evicting an idle one if needed */
+static void stack_cache_track(k_thread_stack_t *stack, size_t size)
+{
+	struct stack_cache_entry *slot = NULL;
+	k_thread_stack_t *evicted = NULL;
+
+	K_SPINLOCK(&stack_cache_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(stack_cache); i++) {
+			struct stack_cache_entry *entry = &stack_cache[i];
+
+			if (entry->stack == NULL) {
+				slot = entry;
+				break;
+			}
+
+			if ((slot == NULL) && entry->idle) {
+				slot = entry;
+			}
+		}
+
+		if (slot != NULL) {
+			evicted = slot->idle ? slot->stack : NULL;
+			slot->stack = stack;
+			slot->size = size;
+			slot->idle = false;
+		}
+	}
+
+	if (evicted != NULL) {
+		k_free(evicted);
+	}
+}
+
+/* Returns -ENOENT if the stack is not tracked and must be freed instead */
+static int stack_cache_put(k_thread_stack_t *stack)
+{
+	int ret = -ENOENT;
+
+	K_SPINLOCK(&stack_cache_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(stack_cache); i++) {
+			struct stack_cache_entry *entry = &stack_cache[i];
+
+			if (entry->stack == stack) {
+				ret = entry->idle ? -EINVAL : 0;
+				entry->idle = true;
+				break;
+			}
+		}
+	}
+
+	return ret;
+}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0 */
+
 static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t align, size_t size)
 {
+#if CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0
+	k_thread_stack_t *stack = stack_cache_get(size);
+
+	if (stack == NULL) {
+		stack = z_thread_aligned_alloc(align, size);
+		if (stack != NULL) {
+			stack_cache_track(stack, size);
+		}
+	}
+
+	return stack;
+#else
 	return z_thread_aligned_alloc(align, size);
+#endif
 }
 
 static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size)
@@ -151,6 +252,17 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 	}
 
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_ALLOC)) {
+#if CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0
+		int rv = stack_cache_put(stack);
+
+		if (rv != -ENOENT) {
+			if (rv < 0) {
+				LOG_ERR("stack %p is not allocated!", stack);
+			}
+
+			return rv;
+		}
+#endif
 #ifdef CONFIG_USERSPACE
 		if (z_object_find(stack)) {
 			k_object_free(stack);
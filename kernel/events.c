@@ -52,7 +52,7 @@ void z_impl_k_event_init(struct k_event *event)
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
 
-	z_waitq_init(&event->wait_q);
+	z_waitq_init_locked(&event->wait_q, &event->lock);
 
 	z_object_init(event);
 }
@@ -158,7 +158,14 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 			arch_thread_return_value_set(thread, 0);
 			thread->events = events;
 			next = thread->next_event_link;
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+			/* The wait queue is ours to edit under event->lock */
+			thread->no_wake_on_timeout = false;
+			z_unpend_thread(thread);
+			z_ready_thread(thread);
+#else
 			z_sched_wake_thread(thread, false);
+#endif
 			thread = next;
 		} while (thread != NULL);
 	}
@@ -607,6 +607,19 @@ size_t arch_tls_stack_setup(struct k_thread *new_thread, char *stack_ptr);
 
 /** @} */
 
+/**
+ * @brief Get the floating point context counters of a thread
+ *
+ * Only required with CONFIG_SCHED_THREAD_USAGE_FPU, for architectures
+ * selecting CONFIG_ARCH_HAS_FPU_USAGE_STATS.
+ *
+ * @param thread Thread to query
+ * @param saves Number of times the FP registers were saved on preemption
+ * @param traps Number of traps taken to give the thread the FP unit
+ */
+void arch_thread_fpu_usage(struct k_thread *thread, uint32_t *saves,
+			   uint32_t *traps);
+
 /* Include arch-specific inline function implementation */
 #include <kernel_arch_func.h>
 
@@ -108,7 +108,8 @@ static inline bool z_is_thread_prevented_from_running(struct k_thread *thread)
 	uint8_t state = thread->base.thread_state;
 
 	return (state & (_THREAD_PENDING | _THREAD_PRESTART | _THREAD_DEAD |
-			 _THREAD_DUMMY | _THREAD_SUSPENDED)) != 0U;
+			 _THREAD_DUMMY | _THREAD_SUSPENDED |
+			 _THREAD_THROTTLED)) != 0U;
 
 }
 
@@ -138,6 +139,19 @@ static inline bool z_is_thread_queued(struct k_thread *thread)
 	return z_is_thread_state_set(thread, _THREAD_QUEUED);
 }
 
+#ifdef CONFIG_SMP
+/* Lockless hint for adaptive spinning: true if the thread was the
+ * current thread of the CPU it last ran on when this was called.  The
+ * caller must not be that thread.
+ */
+static inline bool z_is_thread_running(struct k_thread *thread)
+{
+	unsigned int cpu = *(volatile uint8_t *)&thread->base.cpu;
+
+	return *(struct k_thread *volatile *)&_kernel.cpus[cpu].current == thread;
+}
+#endif /* CONFIG_SMP */
+
 static inline void z_mark_thread_as_suspended(struct k_thread *thread)
 {
 	thread->base.thread_state |= _THREAD_SUSPENDED;
@@ -321,6 +335,9 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data);
  * Given a specific thread, wake it up. This routine assumes that the given
  * thread is not on the timeout queue.
  *
+ * Must not be called with the lock of the object the thread is pended on
+ * held when that object's wait queue was set up with z_waitq_init_locked().
+ *
  * @param thread Given thread to wake up.
  * @param is_timeout True if called from the timer ISR; false otherwise.
  *
@@ -380,7 +397,9 @@ int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
  *
  * This function walks the wait queue invoking the callback function on each
  * waiting thread while holding sched_spinlock. This can be useful for routines
- * that need to operate on multiple waiting threads.
+ * that need to operate on multiple waiting threads.  A wait queue set up with
+ * z_waitq_init_locked() is instead walked under its object's lock, which the
+ * caller must hold.
  *
  * CAUTION! As a wait queue is of indeterminant length, the scheduler will be
  * locked for an indeterminant amount of time. This may impact system
@@ -428,6 +447,40 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_RUNQ_LATENCY
+/**
+ * @brief Account the run queue latency of a thread being switched in
+ *
+ * Called with interrupts masked (and the scheduler lock held on SMP)
+ * wherever a new thread is made current.
+ */
+void z_sched_runq_latency_record(struct k_thread *thread);
+
+/**
+ * @brief Start the run queue latency of a thread being switched out
+ *
+ * Called at the same points as z_sched_runq_latency_record() with the
+ * outgoing thread, which starts waiting again if it was preempted or
+ * yielded rather than blocked.
+ */
+void z_sched_runq_latency_switch_out(struct k_thread *thread);
+#else
+#define z_sched_runq_latency_record(thread) do { } while (false)
+#define z_sched_runq_latency_switch_out(thread) do { } while (false)
+#endif
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Start charging the CBS budget of a thread being switched in
+ *
+ * Charges the server that was running until now, if any.  Called with
+ * interrupts masked wherever a new thread is made current.
+ */
+void z_sched_cbs_switch(struct k_thread *thread);
+#else
+#define z_sched_cbs_switch(thread) do { } while (false)
+#endif
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
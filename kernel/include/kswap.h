@@ -123,6 +123,9 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 	if (new_thread != old_thread) {
 		z_sched_usage_switch(new_thread);
+		z_sched_runq_latency_record(new_thread);
+		z_sched_runq_latency_switch_out(old_thread);
+		z_sched_cbs_switch(new_thread);
 
 #ifdef CONFIG_SMP
 		_current_cpu->swap_ok = 0;
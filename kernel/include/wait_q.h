@@ -24,7 +24,7 @@ extern "C" {
 #define _WAIT_Q_FOR_EACH(wq, thread_ptr) \
 	RB_FOR_EACH_CONTAINER(&(wq)->waitq.tree, thread_ptr, base.qnode_rb)
 
-static inline void z_waitq_init(_wait_q_t *w)
+static inline void z_waitq_init_queue(_wait_q_t *w)
 {
 	w->waitq = (struct _priq_rb) {
 		.tree = {
@@ -44,7 +44,7 @@ static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 	SYS_DLIST_FOR_EACH_CONTAINER(&((wq)->waitq), thread_ptr, \
 				     base.qnode_dlist)
 
-static inline void z_waitq_init(_wait_q_t *w)
+static inline void z_waitq_init_queue(_wait_q_t *w)
 {
 	sys_dlist_init(&w->waitq);
 }
@@ -56,6 +56,32 @@ static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 
 #endif /* !CONFIG_WAITQ_SCALABLE */
 
+static inline void z_waitq_init(_wait_q_t *w)
+{
+	z_waitq_init_queue(w);
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	w->lock = NULL;
+#endif
+}
+
+/*
+ * Initialize a wait queue owned by an object protected by @a lock.  With
+ * CONFIG_WAITQ_OBJ_LOCK the scheduler then relies on @a lock, not on its
+ * own lock, to protect the queue: callers of z_pend_curr() must pass that
+ * lock, and z_unpend_first_thread(), z_unpend_thread() and
+ * z_sched_waitq_walk() must be called with it held.  A thread taken off
+ * such a queue stays pending until it is passed to z_ready_thread().
+ */
+static inline void z_waitq_init_locked(_wait_q_t *w, struct k_spinlock *lock)
+{
+	z_waitq_init_queue(w);
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	w->lock = lock;
+#else
+	ARG_UNUSED(lock);
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
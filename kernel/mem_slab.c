@@ -85,6 +85,14 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		slab->cpu_cache[i].lock = (struct k_spinlock) {};
+		slab->cpu_cache[i].count = 0U;
+	}
+	slab->cache_bypass = 0U;
+#endif
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->max_used = 0U;
 #endif
@@ -102,26 +110,165 @@ out:
 	return rc;
 }
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+#define CACHE_BATCH MAX(1, CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2)
+
+/* Every per-CPU cache has its own lock, which is only contended when
+ * the shared free list runs empty and another CPU drains the caches.
+ * Lock order is slab->lock, then a cache lock.
+ *
+ * slab->cache_bypass counts the allocations that are draining the caches
+ * or waiting for a block. It is raised before the caches are drained,
+ * so a free that finds it zero under a cache lock puts its block where
+ * the drain finds it. Any other free takes the regular path, which
+ * serializes with the drain and hands the block to a waiter.
+ */
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+	bool ret = false;
+
+	K_SPINLOCK(&cache->lock) {
+		if (cache->count != 0U) {
+			*mem = cache->blocks[--cache->count];
+			ret = true;
+		}
+	}
+
+	return ret;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+	bool ret = false;
+
+	K_SPINLOCK(&cache->lock) {
+		if ((slab->cache_bypass == 0U) &&
+		    (cache->count < CONFIG_MEM_SLAB_CPU_CACHE_SIZE)) {
+			cache->blocks[cache->count++] = mem;
+			ret = true;
+		}
+	}
+
+	return ret;
+}
+
+/* Move a batch of blocks from the free list to the local cache, called
+ * with slab->lock held.
+ */
+static void cache_fill(struct k_mem_slab *slab)
+{
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+
+	if (slab->cache_bypass != 0U) {
+		return;
+	}
+
+	K_SPINLOCK(&cache->lock) {
+		while ((cache->count < CACHE_BATCH) && (slab->free_list != NULL)) {
+			cache->blocks[cache->count++] = slab->free_list;
+			slab->free_list = *(char **)(slab->free_list);
+			slab->num_used++;
+		}
+	}
+}
+
+/* Move a batch of blocks from a full local cache to the free list,
+ * called with slab->lock held.
+ */
+static void cache_trim(struct k_mem_slab *slab)
+{
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+
+	K_SPINLOCK(&cache->lock) {
+		if (cache->count < CONFIG_MEM_SLAB_CPU_CACHE_SIZE) {
+			K_SPINLOCK_BREAK;
+		}
+
+		while (cache->count > (CONFIG_MEM_SLAB_CPU_CACHE_SIZE - CACHE_BATCH)) {
+			char *block = cache->blocks[--cache->count];
+
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+			slab->num_used--;
+		}
+	}
+}
+
+/* Return the blocks of all caches to the free list, called with
+ * slab->lock held.
+ */
+static void cache_drain(struct k_mem_slab *slab)
+{
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[i];
+
+		K_SPINLOCK(&cache->lock) {
+			while (cache->count != 0U) {
+				char *block = cache->blocks[--cache->count];
+
+				*(char **)block = slab->free_list;
+				slab->free_list = block;
+				slab->num_used--;
+			}
+		}
+	}
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool wait = !K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+		    IS_ENABLED(CONFIG_MULTITHREADING);
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	bool waiter = false;
+
+	if (slab->free_list == NULL) {
+		/* Make frees bypass the caches before looking at them, see
+		 * cache_free(). A waiter keeps them bypassed until it wakes up.
+		 */
+		slab->cache_bypass++;
+
+		cache_drain(slab);
+
+		if (wait && (slab->free_list == NULL)) {
+			waiter = true;
+		} else {
+			slab->cache_bypass--;
+		}
+	}
+#endif
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
 		slab->num_used++;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		cache_fill(slab);
+#endif
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 		slab->max_used = MAX(slab->num_used, slab->max_used);
 #endif
 
 		result = 0;
-	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
-		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
+	} else if (!wait) {
 		/* don't wait for a free block to become available */
 		*mem = NULL;
 		result = -ENOMEM;
@@ -134,6 +281,14 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		if (waiter) {
+			K_SPINLOCK(&slab->lock) {
+				slab->cache_bypass--;
+			}
+		}
+#endif
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
@@ -148,13 +303,21 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
-
 	__ASSERT(((char *)mem >= slab->buffer) &&
 		 ((((char *)mem - slab->buffer) % slab->block_size) == 0) &&
 		 ((char *)mem <= (slab->buffer + (slab->block_size * (slab->num_blocks - 1)))),
 		 "Invalid memory pointer provided");
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif
+
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
 	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
 		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
@@ -172,6 +335,10 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 	slab->free_list = (char *) mem;
 	slab->num_used--;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	cache_trim(slab);
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
 	k_spin_unlock(&slab->lock, key);
@@ -185,8 +352,10 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->num_used * slab->block_size;
-	stats->free_bytes = (slab->num_blocks - slab->num_used) * slab->block_size;
+	uint32_t num_used = k_mem_slab_num_used_get(slab);
+
+	stats->allocated_bytes = num_used * slab->block_size;
+	stats->free_bytes = (slab->num_blocks - num_used) * slab->block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->max_used * slab->block_size;
 #else
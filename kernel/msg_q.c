@@ -32,6 +32,55 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+/* Copy up to num_msgs messages from src into the ring buffer, as far as
+ * there is room, using at most two copies.  Returns the number copied.
+ */
+static uint32_t msgq_ring_put(struct k_msgq *msgq, const char *src,
+			      uint32_t num_msgs)
+{
+	uint32_t n = MIN(num_msgs, msgq->max_msgs - msgq->used_msgs);
+	size_t len = (size_t)n * msgq->msg_size;
+	size_t to_end = msgq->buffer_end - msgq->write_ptr;
+
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+
+	if (len < to_end) {
+		(void)memcpy(msgq->write_ptr, src, len);
+		msgq->write_ptr += len;
+	} else {
+		(void)memcpy(msgq->write_ptr, src, to_end);
+		(void)memcpy(msgq->buffer_start, src + to_end, len - to_end);
+		msgq->write_ptr = msgq->buffer_start + (len - to_end);
+	}
+	msgq->used_msgs += n;
+
+	return n;
+}
+
+/* Copy up to num_msgs queued messages out of the ring buffer into dst,
+ * using at most two copies.  Returns the number copied.
+ */
+static uint32_t msgq_ring_get(struct k_msgq *msgq, char *dst,
+			      uint32_t num_msgs)
+{
+	uint32_t n = MIN(num_msgs, msgq->used_msgs);
+	size_t len = (size_t)n * msgq->msg_size;
+	size_t to_end = msgq->buffer_end - msgq->read_ptr;
+
+	if (len < to_end) {
+		(void)memcpy(dst, msgq->read_ptr, len);
+		msgq->read_ptr += len;
+	} else {
+		(void)memcpy(dst, msgq->read_ptr, to_end);
+		(void)memcpy(dst + to_end, msgq->buffer_start, len - to_end);
+		msgq->read_ptr = msgq->buffer_start + (len - to_end);
+	}
+	msgq->used_msgs -= n;
+
+	return n;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -43,7 +92,7 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
 	msgq->flags = 0;
-	z_waitq_init(&msgq->wait_q);
+	z_waitq_init_locked(&msgq->wait_q, &msgq->lock);
 	msgq->lock = (struct k_spinlock) {};
 #ifdef CONFIG_POLL
 	sys_dlist_init(&msgq->poll_events);
@@ -187,6 +236,120 @@ static inline int z_vrfy_k_msgq_put(struct k_msgq *msgq, const void *data,
 #include <syscalls/k_msgq_put_mrsh.c>
 #endif
 
+/* Move up to num_msgs messages from src to waiting receivers and then to
+ * the ring buffer, without blocking.
+ *
+ * Invoked with msgq lock held.
+ */
+static uint32_t msgq_put_many_locked(struct k_msgq *msgq, const char *src,
+				     uint32_t num_msgs, bool *woken)
+{
+	struct k_thread *pending_thread;
+	uint32_t sent = 0U;
+
+	/* Threads can only be waiting to receive while the queue is
+	 * empty, so hand them messages directly first.
+	 */
+	while ((sent < num_msgs) && (msgq->used_msgs == 0U)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(pending_thread->base.swap_data, src,
+			     msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		*woken = true;
+		src += msgq->msg_size;
+		sent++;
+	}
+
+	if (sent < num_msgs) {
+		uint32_t queued = msgq_ring_put(msgq, src, num_msgs - sent);
+
+		sent += queued;
+#ifdef CONFIG_POLL
+		if (queued > 0U) {
+			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+		}
+#endif /* CONFIG_POLL */
+	}
+
+	return sent;
+}
+
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			   uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *src = data;
+	k_spinlock_key_t key;
+	bool woken = false;
+	uint32_t sent;
+	int result;
+
+	CHECKIF(num_msgs == 0U) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_many, msgq, timeout);
+
+	sent = msgq_put_many_locked(msgq, src, num_msgs, &woken);
+
+	if (sent > 0U) {
+		result = (int)sent;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for message space to become available */
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_many, msgq, timeout);
+
+		/* wait for the first message to be taken, then send as many
+		 * of the rest as fit without waiting again
+		 */
+		_current->base.swap_data = (void *)data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if ((result != 0) || (num_msgs == 1U)) {
+			result = (result == 0) ? 1 : result;
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout,
+						       result);
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+		result = 1 + (int)msgq_put_many_locked(msgq, src + msgq->msg_size,
+						       num_msgs - 1U, &woken);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq,
+					 const void *data, uint32_t num_msgs,
+					 k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_put_many_mrsh.c>
+#endif
+
 void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
@@ -285,6 +448,113 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+/* Move up to num_msgs messages from the ring buffer to dst, refilling
+ * it from waiting senders, without blocking.
+ *
+ * Invoked with msgq lock held.
+ */
+static uint32_t msgq_get_many_locked(struct k_msgq *msgq, char *dst,
+				     uint32_t num_msgs, bool *woken)
+{
+	struct k_thread *pending_thread;
+	uint32_t received = 0U;
+
+	while ((received < num_msgs) && (msgq->used_msgs > 0U)) {
+		uint32_t n = msgq_ring_get(msgq, dst, num_msgs - received);
+
+		dst += (size_t)n * msgq->msg_size;
+		received += n;
+
+		/* Threads can only be waiting to send while the queue is
+		 * not empty: let one of them into each slot just freed.
+		 */
+		while (n-- > 0U) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+			if (pending_thread == NULL) {
+				break;
+			}
+
+			(void)msgq_ring_put(msgq, pending_thread->base.swap_data, 1U);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			*woken = true;
+		}
+	}
+
+	return received;
+}
+
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data,
+			   uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	char *dst = data;
+	k_spinlock_key_t key;
+	bool woken = false;
+	uint32_t received;
+	int result;
+
+	CHECKIF(num_msgs == 0U) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_many, msgq, timeout);
+
+	received = msgq_get_many_locked(msgq, dst, num_msgs, &woken);
+
+	if (received > 0U) {
+		result = (int)received;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_many, msgq, timeout);
+
+		/* wait for the first message, then receive whatever else is
+		 * queued by then without waiting again
+		 */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if ((result != 0) || (num_msgs == 1U)) {
+			result = (result == 0) ? 1 : result;
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout,
+						       result);
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+		result = 1 + (int)msgq_get_many_locked(msgq, dst + msgq->msg_size,
+						       num_msgs - 1U, &woken);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t num_msgs,
+					 k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_get_many_mrsh.c>
+#endif
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -92,6 +92,39 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Called with the lock held on a mutex owned by another thread.  While
+ * the owner keeps running on another CPU and nobody is pended on the
+ * mutex (who would be handed it on release), poll for the mutex to be
+ * released for up to CONFIG_ADAPTIVE_SPIN_NS, so short critical sections
+ * don't cost a pend and a wakeup.  Returns with the lock held again; the
+ * caller re-checks the mutex state.
+ */
+static k_spinlock_key_t mutex_adaptive_spin(struct k_mutex *mutex,
+					    k_spinlock_key_t key)
+{
+	struct k_thread *owner = mutex->owner;
+	uint32_t budget = k_ns_to_cyc_ceil32(CONFIG_ADAPTIVE_SPIN_NS);
+	uint32_t start;
+
+	if (z_waitq_head(&mutex->wait_q) != NULL) {
+		return key;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	start = k_cycle_get_32();
+	while ((*(struct k_thread *volatile *)&mutex->owner == owner) &&
+	       z_is_thread_running(owner) &&
+	       ((k_cycle_get_32() - start) < budget)) {
+		arch_spin_relax();
+	}
+
+	return k_spin_lock(&lock);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -104,6 +137,13 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		key = mutex_adaptive_spin(mutex, key);
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -39,6 +39,8 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0U;
 	pipe->read_index = 0U;
 	pipe->write_index = 0U;
+	pipe->put_claimed = 0U;
+	pipe->get_claimed = 0U;
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
@@ -176,6 +178,8 @@ int k_pipe_cleanup(struct k_pipe *pipe)
 		pipe->bytes_used = 0U;
 		pipe->read_index = 0U;
 		pipe->write_index = 0U;
+		pipe->put_claimed = 0U;
+		pipe->get_claimed = 0U;
 		pipe->flags &= ~K_PIPE_FLAG_ALLOC;
 	}
 
@@ -369,6 +373,110 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
+/**
+ * @brief Refill the pipe buffer from waiting writers
+ *
+ * Does nothing if the buffer is full or a zero-copy write claim is
+ * outstanding, as that claim owns the free space.
+ */
+static void pipe_refill(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc   pipe_desc[2];
+	sys_dlist_t         src_list;
+	sys_dlist_t         pipe_list;
+
+	if ((pipe->bytes_used == pipe->size) || (pipe->put_claimed != 0U)) {
+		return;
+	}
+
+	/*
+	 * The pipe is not full. If there are any waiting writers,
+	 * refill the pipe.
+	 */
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&pipe_list);
+
+	(void) pipe_waiter_list_populate(&src_list,
+					 &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->write_index,
+					 pipe->read_index);
+
+	(void) pipe_write(pipe, &src_list, &pipe_list, reschedule);
+}
+
+/**
+ * @brief Drain the pipe buffer into waiting readers
+ *
+ * Does nothing if the buffer is empty or a zero-copy read claim is
+ * outstanding, as that claim owns the buffered data.
+ */
+static void pipe_drain(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc   pipe_desc[2];
+	struct _pipe_desc  *src;
+	struct _pipe_desc  *dest;
+	sys_dlist_t         src_list;
+	sys_dlist_t         dest_list;
+	size_t              bytes_copied;
+
+	if ((pipe->bytes_used == 0U) || (pipe->get_claimed != 0U)) {
+		return;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&dest_list);
+
+	(void) pipe_buffer_list_populate(&src_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->read_index,
+					 pipe->write_index);
+
+	(void) pipe_waiter_list_populate(&dest_list,
+					 &pipe->wait_q.readers,
+					 pipe->bytes_used);
+
+	src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+	dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+
+	while ((src != NULL) && (dest != NULL)) {
+		bytes_copied = pipe_xfer(dest->buffer, dest->bytes_to_xfer,
+					 src->buffer, src->bytes_to_xfer);
+
+		dest->buffer        += bytes_copied;
+		dest->bytes_to_xfer -= bytes_copied;
+
+		src->buffer         += bytes_copied;
+		src->bytes_to_xfer  -= bytes_copied;
+
+		pipe->bytes_used -= bytes_copied;
+		pipe->read_index += bytes_copied;
+		if (pipe->read_index >= pipe->size) {
+			pipe->read_index -= pipe->size;
+		}
+
+		if (dest->bytes_to_xfer == 0U) {
+
+			/* The thread's read request has been satisfied. */
+
+			z_unpend_thread(dest->thread);
+			z_ready_thread(dest->thread);
+
+			*reschedule = true;
+
+			dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+		}
+
+		if (src->bytes_to_xfer == 0U) {
+			src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+		}
+	}
+}
+
 int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 		     size_t *bytes_written, size_t min_xfer,
 		      k_timeout_t timeout)
@@ -407,7 +515,7 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 						    &pipe->wait_q.readers,
 						    bytes_to_write);
 
-	if (pipe->bytes_used != pipe->size) {
+	if ((pipe->bytes_used != pipe->size) && (pipe->put_claimed == 0U)) {
 		bytes_can_write += pipe_buffer_list_populate(&dest_list,
 							     pipe_desc,
 							     pipe->buffer,
@@ -544,7 +652,7 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 	sys_dlist_init(&src_list);
 
-	if (pipe->bytes_used != 0) {
+	if ((pipe->bytes_used != 0) && (pipe->get_claimed == 0U)) {
 		bytes_can_read = pipe_buffer_list_populate(&src_list,
 							   pipe_desc,
 							   pipe->buffer,
@@ -617,29 +725,7 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	}
 
-	if (pipe->bytes_used != pipe->size) {
-		sys_dlist_t         pipe_list;
-
-		/*
-		 * The pipe is not full. If there are any waiting writers,
-		 * refill the pipe.
-		 */
-
-		sys_dlist_init(&src_list);
-		sys_dlist_init(&pipe_list);
-
-		(void) pipe_waiter_list_populate(&src_list,
-						 &pipe->wait_q.writers,
-						 pipe->size - pipe->bytes_used);
-
-		(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
-						 pipe->buffer, pipe->size,
-						 pipe->write_index,
-						 pipe->read_index);
-
-		(void) pipe_write(pipe, &src_list,
-				  &pipe_list, &reschedule_needed);
-	}
+	pipe_refill(pipe, &reschedule_needed);
 
 	/*
 	 * The immediate success conditions below are backwards
@@ -728,6 +814,120 @@ int z_vrfy_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 #include <syscalls/k_pipe_get_mrsh.c>
 #endif
 
+size_t k_pipe_put_claim(struct k_pipe *pipe, unsigned char **data,
+			size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t free_space = pipe->size - pipe->bytes_used - pipe->put_claimed;
+	size_t start = pipe->write_index + pipe->put_claimed;
+
+	if (start >= pipe->size) {
+		start -= pipe->size;
+	}
+
+	size = MIN(size, MIN(free_space, pipe->size - start));
+	pipe->put_claimed += size;
+	*data = &pipe->buffer[start];
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return size;
+}
+
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size)
+{
+	bool reschedule_needed = false;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(size > pipe->put_claimed) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+	pipe->put_claimed = 0U;
+
+	/* Readers may have been waiting on an empty buffer */
+
+	pipe_drain(pipe, &reschedule_needed);
+
+	if ((pipe->bytes_used != 0U) && (size != 0U)) {
+		handle_poll_events(pipe);
+	}
+
+	/* Unclaimed space was handed back and may now take queued writes */
+
+	pipe_refill(pipe, &reschedule_needed);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+size_t k_pipe_get_claim(struct k_pipe *pipe, unsigned char **data,
+			size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t avail = pipe->bytes_used - pipe->get_claimed;
+	size_t start = pipe->read_index + pipe->get_claimed;
+
+	if (start >= pipe->size) {
+		start -= pipe->size;
+	}
+
+	size = MIN(size, MIN(avail, pipe->size - start));
+	pipe->get_claimed += size;
+	*data = &pipe->buffer[start];
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return size;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	bool reschedule_needed = false;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(size > pipe->get_claimed) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+	pipe->get_claimed = 0U;
+
+	/* Data left unconsumed may go to readers waiting behind the claim */
+
+	pipe_drain(pipe, &reschedule_needed);
+
+	/* Space was freed; let waiting writers in */
+
+	pipe_refill(pipe, &reschedule_needed);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
 size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 {
 	size_t res;
@@ -749,6 +949,9 @@ size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 		res = pipe->size - (pipe->read_index - pipe->write_index);
 	}
 
+	/* Claimed data is the claiming reader's */
+	res -= pipe->get_claimed;
+
 	k_spin_unlock(&pipe->lock, key);
 
 out:
@@ -786,6 +989,9 @@ size_t z_impl_k_pipe_write_avail(struct k_pipe *pipe)
 		res = pipe->size - (pipe->write_index - pipe->read_index);
 	}
 
+	/* Claimed space is the claiming writer's */
+	res -= pipe->put_claimed;
+
 	k_spin_unlock(&pipe->lock, key);
 
 out:
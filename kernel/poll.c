@@ -34,10 +34,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static void signal_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -113,17 +114,20 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 {
 	struct k_poll_event *pending;
 
+	/* Poll sets have no thread to order them by, they come last */
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || (poller->mode == MODE_SET) ||
+		((pending->poller->mode != MODE_SET) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+				   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if ((pending->poller->mode == MODE_SET) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+				      poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -446,6 +450,11 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
+	if ((poller != NULL) && (poller->mode == MODE_SET)) {
+		signal_set(event, state);
+		return 0;
+	}
+
 	if (poller != NULL) {
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
@@ -813,3 +822,160 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+/* Poll sets
+ *
+ * An event of a set is always on exactly one list: its object's
+ * poll_events list while armed, or the set's ready list once the object
+ * signaled it.  Waiting only walks the ready list, and only events found
+ * no longer ready there go back to their object.
+ */
+
+static struct k_poll_set *poller_set(struct z_poller *p)
+{
+	return CONTAINER_OF(p, struct k_poll_set, poller);
+}
+
+/* must be called with interrupts locked */
+static void signal_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = poller_set(event->poller);
+	struct k_thread *thread;
+
+	event->state = state;
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t state;
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	event->state = K_POLL_STATE_NOT_READY;
+	event->poller = &set->poller;
+
+	if (is_condition_met(event, &state)) {
+		signal_set(event, state);
+		z_reschedule(&lock, key);
+		return 0;
+	}
+
+	register_event(event, &set->poller);
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static int collect_ready(struct k_poll_set *set, struct k_poll_event **ready,
+			 int max_events)
+{
+	struct k_poll_event *event;
+	sys_dnode_t *first = NULL;
+	sys_dnode_t *node;
+	uint32_t state;
+	int n = 0;
+
+	/* Events reported go to the tail, stop once we come back to them */
+	while (n < max_events) {
+		node = sys_dlist_peek_head(&set->ready);
+		if ((node == NULL) || (node == first)) {
+			break;
+		}
+
+		event = CONTAINER_OF(node, struct k_poll_event, _node);
+		sys_dlist_remove(node);
+
+		if ((event->state & K_POLL_STATE_CANCELLED) != 0U) {
+			/* Reported once, the object is armed again right away */
+			ready[n++] = event;
+			register_event(event, &set->poller);
+			continue;
+		}
+
+		if (!is_condition_met(event, &state)) {
+			event->state = K_POLL_STATE_NOT_READY;
+			register_event(event, &set->poller);
+			continue;
+		}
+
+		event->state = state;
+		sys_dlist_append(&set->ready, node);
+		if (first == NULL) {
+			first = node;
+		}
+		ready[n++] = event;
+	}
+
+	return n;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int n;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL ready\n");
+	__ASSERT(max_events > 0, "no room for events\n");
+
+	key = k_spin_lock(&lock);
+
+	while (true) {
+		n = collect_ready(set, ready, max_events);
+		if ((n > 0) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		if (z_pend_curr(&lock, key, &set->wait_q, timeout) != 0) {
+			return -EAGAIN;
+		}
+
+		/* Another waiter may have taken what woke us up */
+		timeout = sys_timepoint_timeout(end);
+		key = k_spin_lock(&lock);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return (n > 0) ? n : -EAGAIN;
+}
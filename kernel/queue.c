@@ -59,7 +59,7 @@ void z_impl_k_queue_init(struct k_queue *queue)
 {
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
-	z_waitq_init(&queue->wait_q);
+	z_waitq_init_locked(&queue->wait_q, &queue->lock);
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -218,6 +218,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
 #endif
@@ -225,26 +227,154 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
 #endif
 }
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+/* Threads queued on a CPU, plus the one it is running unless that is
+ * its idle thread.
+ */
+static inline uint32_t cpu_load(int cpu)
+{
+	struct k_thread *curr = _kernel.cpus[cpu].current;
+	uint32_t load = _kernel.cpus[cpu].ready_q.nr_queued;
+
+	if ((curr != NULL) && !z_is_idle_thread_object(curr)) {
+		load++;
+	}
+
+	return load;
+}
+
+/* Choose the run queue for a thread becoming runnable: the CPU it last
+ * ran on if allowed, unless another allowed CPU is less loaded.
+ */
+static int runq_pick_cpu(struct k_thread *thread)
+{
+	uint32_t mask = BIT_MASK(arch_num_cpus());
+	int cpu = thread->base.cpu;
+	uint32_t load;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	mask &= thread->base.cpu_mask;
+#endif
+
+	/* As with PIN_ONLY, a thread with all CPUs masked off is
+	 * legal to queue, it just never gets picked.
+	 */
+	if (mask == 0U) {
+		return 0;
+	}
+
+	if ((mask & BIT(cpu)) == 0U) {
+		cpu = u32_count_trailing_zeros(mask);
+	}
+
+	load = cpu_load(cpu);
+	for (uint32_t m = mask & ~BIT(cpu); (m != 0U) && (load != 0U);
+	     m &= m - 1U) {
+		int i = u32_count_trailing_zeros(m);
+		uint32_t l = cpu_load(i);
+
+		if (l < load) {
+			cpu = i;
+			load = l;
+		}
+	}
+
+	return cpu;
+}
+
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 32, "runq_busy is a 32-bit mask");
+
+/* Best thread this CPU may run: its own queue's best, unless another
+ * CPU's queue has a better one, in which case we steal it (the caller
+ * dequeues it from wherever it is queued).  Only non-empty queues are
+ * looked at.
+ *
+ * Ties between the local best and other queues are decided in turns:
+ * the local queue wins every other one, for cache warmth, and the others
+ * are tried in a rotating order, so equal priority threads queued behind
+ * a CPU that keeps running still get picked up.
+ */
+static struct k_thread *runq_best_steal(void)
+{
+	struct _ready_q *rq = &_current_cpu->ready_q;
+	struct k_thread *best = _priq_run_best(&rq->runq);
+	unsigned int num_cpus = arch_num_cpus();
+	int currcpu = _current_cpu->id;
+	uint32_t others = _kernel.runq_busy & ~BIT(currcpu);
+	bool local = (best != NULL);
+	bool tied = false;
+
+	for (unsigned int n = 0; (n < num_cpus) && (others != 0U); n++) {
+		int i = (currcpu + 1 + rq->nr_ties / 2U + n) % num_cpus;
+		struct k_thread *thread;
+		int32_t cmp;
+
+		if ((others & BIT(i)) == 0U) {
+			continue;
+		}
+		others &= ~BIT(i);
+
+		thread = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if (thread == NULL) {
+			continue;
+		}
+
+		cmp = (best == NULL) ? 1 : z_sched_prio_cmp(thread, best);
+		if ((cmp == 0) && local) {
+			tied = true;
+			if ((rq->nr_ties & 1U) != 0U) {
+				best = thread;
+				local = false;
+			}
+		} else if (cmp > 0) {
+			best = thread;
+			local = false;
+			tied = false;
+		}
+	}
+
+	if (tied) {
+		rq->nr_ties++;
+	}
+
+	return best;
+}
+#endif
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	thread->base.runq_cpu = runq_pick_cpu(thread);
+	_kernel.cpus[thread->base.runq_cpu].ready_q.nr_queued++;
+	_kernel.runq_busy |= BIT(thread->base.runq_cpu);
+#endif
 	_priq_run_add(thread_runq(thread), thread);
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	if (--_kernel.cpus[thread->base.runq_cpu].ready_q.nr_queued == 0U) {
+		_kernel.runq_busy &= ~BIT(thread->base.runq_cpu);
+	}
+#endif
 	_priq_run_remove(thread_runq(thread), thread);
 }
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	return runq_best_steal();
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif
 }
 
 /* _current is never in the run queue until context switch on
@@ -542,6 +672,196 @@ void z_time_slice(void)
 }
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+
+/* Sum of budget / period over all servers, in parts per million */
+static uint32_t cbs_total_util;
+
+/* Server being charged for the CPU since cbs_start, and the timeout
+ * that fires when its budget runs out.  Single CPU only.
+ */
+static struct k_thread *cbs_running;
+static uint32_t cbs_start;
+static struct _timeout cbs_budget_timeout;
+
+static inline bool is_cbs(struct k_thread *thread)
+{
+	return thread->base.cbs.budget != 0U;
+}
+
+static uint32_t cbs_util(uint32_t budget, uint32_t period)
+{
+	if (budget == 0U) {
+		return 0U;
+	}
+
+	return (uint32_t)DIV_ROUND_UP((uint64_t)budget * 1000000U, period);
+}
+
+static void cbs_budget_expired(struct _timeout *t);
+
+static void cbs_charge(uint32_t now)
+{
+	if (cbs_running != NULL) {
+		cbs_running->base.cbs.remaining -= (int32_t)(now - cbs_start);
+		cbs_start = now;
+	}
+}
+
+static void cbs_arm(void)
+{
+	int32_t remaining = MAX(cbs_running->base.cbs.remaining, 0);
+	uint32_t ticks = k_cyc_to_ticks_floor32((uint32_t)remaining);
+
+	/* Firing early only costs a recharge, firing late is an overrun */
+	z_add_timeout(&cbs_budget_timeout, cbs_budget_expired,
+		      K_TICKS(MAX(ticks, 1U) - 1U));
+}
+
+void z_sched_cbs_switch(struct k_thread *thread)
+{
+	uint32_t now;
+
+	if (thread == cbs_running) {
+		return;
+	}
+
+	now = k_cycle_get_32();
+	cbs_charge(now);
+	z_abort_timeout(&cbs_budget_timeout);
+	cbs_running = NULL;
+
+	if (is_cbs(thread)) {
+		cbs_running = thread;
+		cbs_start = now;
+		cbs_arm();
+	}
+}
+
+/* Refill the budget and move to the next period.  Called at the
+ * deadline of a throttled server, or when an overrun is detected
+ * after the deadline has already passed.
+ */
+static void cbs_replenish_locked(struct k_thread *thread, uint32_t now)
+{
+	struct _thread_cbs *cbs = &thread->base.cbs;
+
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(thread);
+	}
+
+	cbs->remaining = (int32_t)cbs->budget + MIN(cbs->remaining, 0);
+	thread->base.prio_deadline += cbs->period;
+	if ((int32_t)(thread->base.prio_deadline - now) <= 0) {
+		thread->base.prio_deadline = now + cbs->period;
+	}
+	thread->base.thread_state &= ~_THREAD_THROTTLED;
+
+	if (z_is_thread_ready(thread)) {
+		queue_thread(thread);
+	}
+	update_cache(0);
+}
+
+static void cbs_replenish(struct _timeout *t)
+{
+	struct k_thread *thread = CONTAINER_OF(t, struct k_thread,
+					       base.cbs.timer);
+
+	K_SPINLOCK(&sched_spinlock) {
+		cbs_replenish_locked(thread, k_cycle_get_32());
+	}
+}
+
+static void cbs_budget_expired(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	K_SPINLOCK(&sched_spinlock) {
+		struct k_thread *thread = cbs_running;
+		uint32_t now = k_cycle_get_32();
+		int32_t delay;
+
+		if (thread == NULL) {
+			K_SPINLOCK_BREAK;
+		}
+
+		cbs_charge(now);
+		if (thread->base.cbs.remaining > 0) {
+			/* Fired early because of tick rounding */
+			cbs_arm();
+			K_SPINLOCK_BREAK;
+		}
+
+		delay = (int32_t)(thread->base.prio_deadline - now);
+		if (delay <= 0) {
+			cbs_replenish_locked(thread, now);
+			if (thread == cbs_running) {
+				cbs_arm();
+			}
+			K_SPINLOCK_BREAK;
+		}
+
+		/* Throttle until the deadline */
+		if (z_is_thread_queued(thread)) {
+			dequeue_thread(thread);
+		}
+		thread->base.thread_state |= _THREAD_THROTTLED;
+		z_add_timeout(&thread->base.cbs.timer, cbs_replenish,
+			      K_TICKS(k_cyc_to_ticks_ceil32((uint32_t)delay)));
+		update_cache(thread == _current);
+	}
+}
+
+/* CBS wakeup rule: keep the current budget and deadline only if using
+ * up the budget before the deadline would not exceed the bandwidth.
+ */
+static void cbs_wakeup(struct k_thread *thread)
+{
+	struct _thread_cbs *cbs = &thread->base.cbs;
+	uint32_t now = k_cycle_get_32();
+	int32_t left = (int32_t)(thread->base.prio_deadline - now);
+
+	if (!is_cbs(thread) || (thread == _current)) {
+		return;
+	}
+
+	if ((left <= 0) || ((int64_t)cbs->remaining * cbs->period >=
+			    (int64_t)left * cbs->budget)) {
+		cbs->remaining = (int32_t)cbs->budget;
+		thread->base.prio_deadline = now + cbs->period;
+	}
+}
+
+/* Stop running a thread as a server, releasing its bandwidth */
+static void cbs_detach(struct k_thread *thread)
+{
+	if (!is_cbs(thread)) {
+		return;
+	}
+
+	if (thread == cbs_running) {
+		z_abort_timeout(&cbs_budget_timeout);
+		cbs_running = NULL;
+	}
+	(void)z_abort_timeout(&thread->base.cbs.timer);
+
+	cbs_total_util -= cbs_util(thread->base.cbs.budget,
+				   thread->base.cbs.period);
+	thread->base.cbs.budget = 0U;
+	thread->base.cbs.period = 0U;
+
+	if (z_is_thread_state_set(thread, _THREAD_THROTTLED)) {
+		thread->base.thread_state &= ~_THREAD_THROTTLED;
+		if (z_is_thread_ready(thread)) {
+			queue_thread(thread);
+			update_cache(0);
+		}
+	}
+}
+
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 /* Track cooperative threads preempted by metairqs so we can return to
  * them specifically.  Called at the moment a new thread has been
  * selected to run.
@@ -610,6 +930,60 @@ static bool thread_active_elsewhere(struct k_thread *thread)
 	return false;
 }
 
+#ifdef CONFIG_SCHED_RUNQ_LATENCY
+static inline void runq_latency_stamp(struct k_thread *thread)
+{
+	uint32_t now = k_cycle_get_32();
+
+	/* Zero means "not waiting to run" */
+	thread->base.ready_stamp = (now == 0U) ? 1U : now;
+}
+
+void z_sched_runq_latency_record(struct k_thread *thread)
+{
+	struct k_runq_latency_stats *stats = &thread->base.runq_latency;
+	uint32_t cycles;
+
+	if (thread->base.ready_stamp == 0U) {
+		return;
+	}
+
+	cycles = k_cycle_get_32() - thread->base.ready_stamp;
+	thread->base.ready_stamp = 0U;
+
+	stats->buckets[MAX(find_msb_set(cycles), 1U) - 1U]++;
+	stats->total += cycles;
+	stats->max = MAX(stats->max, cycles);
+}
+
+void z_sched_runq_latency_switch_out(struct k_thread *thread)
+{
+	/* A thread that was readied and never got to run keeps its
+	 * original stamp
+	 */
+	if ((thread->base.ready_stamp == 0U) && z_is_thread_ready(thread)
+	    && !z_is_idle_thread_object(thread)) {
+		runq_latency_stamp(thread);
+	}
+}
+
+int k_thread_runq_latency_get(k_tid_t thread,
+			      struct k_runq_latency_stats *stats)
+{
+	if ((thread == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&sched_spinlock) {
+		*stats = thread->base.runq_latency;
+	}
+
+	return 0;
+}
+#else
+#define runq_latency_stamp(thread) do { } while (false)
+#endif /* CONFIG_SCHED_RUNQ_LATENCY */
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -622,7 +996,11 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		cbs_wakeup(thread);
+#endif
 		queue_thread(thread);
+		runq_latency_stamp(thread);
 		update_cache(0);
 		flag_ipi();
 	}
@@ -631,6 +1009,14 @@ static void ready_thread(struct k_thread *thread)
 void z_ready_thread(struct k_thread *thread)
 {
 	K_SPINLOCK(&sched_spinlock) {
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+		/* Taken off an object-locked wait queue, see
+		 * z_waitq_init_locked(): it was left pending for us
+		 */
+		if (thread->base.pended_on == NULL) {
+			z_mark_thread_as_not_pending(thread);
+		}
+#endif
 		if (!thread_active_elsewhere(thread)) {
 			ready_thread(thread);
 		}
@@ -724,6 +1110,16 @@ static _wait_q_t *pended_on_thread(struct k_thread *thread)
 	return thread->base.pended_on;
 }
 
+static inline bool waitq_obj_locked(_wait_q_t *wait_q)
+{
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	return (wait_q != NULL) && (wait_q->lock != NULL);
+#else
+	ARG_UNUSED(wait_q);
+	return false;
+#endif
+}
+
 static void unready_thread(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
@@ -740,6 +1136,16 @@ static void add_to_waitq_locked(struct k_thread *thread, _wait_q_t *wait_q)
 
 	SYS_PORT_TRACING_FUNC(k_thread, sched_pend, thread);
 
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	/* A thread being aborted is ended on its way out of z_swap()
+	 * with only sched_spinlock held, so it must not be left on a
+	 * queue that its object's lock protects.
+	 */
+	if (waitq_obj_locked(wait_q) && is_aborting(thread)) {
+		wait_q = NULL;
+	}
+#endif
+
 	if (wait_q != NULL) {
 		thread->base.pended_on = wait_q;
 		z_priq_wait_add(&wait_q->waitq, thread);
@@ -767,20 +1173,80 @@ void z_pend_thread(struct k_thread *thread, _wait_q_t *wait_q,
 		   k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(thread == _current || is_thread_dummy(thread));
+	__ASSERT_NO_MSG(!waitq_obj_locked(wait_q));
 	K_SPINLOCK(&sched_spinlock) {
 		pend_locked(thread, wait_q, timeout);
 	}
 }
 
-static inline void unpend_thread_no_timeout(struct k_thread *thread)
+/* Takes the thread off its wait queue, leaving it marked pending */
+static inline void waitq_remove(struct k_thread *thread)
 {
 	_priq_wait_remove(&pended_on_thread(thread)->waitq, thread);
-	z_mark_thread_as_not_pending(thread);
 	thread->base.pended_on = NULL;
 }
 
+static inline void unpend_thread_no_timeout(struct k_thread *thread)
+{
+	waitq_remove(thread);
+	z_mark_thread_as_not_pending(thread);
+}
+
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+/* Locks the object owning the wait queue the thread is pended on, if
+ * that queue is protected by its object's lock.  Returns the lock taken,
+ * or NULL if the thread is not pended on such a queue.
+ *
+ * The object may be freed once the thread is back from its blocking
+ * call, and getting there takes z_ready_thread(), so sched_spinlock.
+ * pended_on is only followed with sched_spinlock held: then a non-NULL
+ * value means the thread is still pending and the object still alive.
+ * As the object lock nests outside sched_spinlock it can only be tried
+ * there; if it is busy, back off and start over.
+ */
+static struct k_spinlock *pended_on_lock(struct k_thread *thread,
+					 k_spinlock_key_t *key)
+{
+	while (true) {
+		k_spinlock_key_t sched_key = k_spin_lock(&sched_spinlock);
+		_wait_q_t *wait_q = thread->base.pended_on;
+		k_spinlock_key_t obj_key;
+
+		if (!waitq_obj_locked(wait_q)) {
+			k_spin_unlock(&sched_spinlock, sched_key);
+			return NULL;
+		}
+
+		if (k_spin_trylock(wait_q->lock, &obj_key) == 0) {
+			if (thread->base.pended_on == wait_q) {
+				/* The object lock inherits the caller's
+				 * interrupt state
+				 */
+				k_spin_release(&sched_spinlock);
+				*key = sched_key;
+				return wait_q->lock;
+			}
+
+			/* Unpended meanwhile, and maybe pended again
+			 * elsewhere
+			 */
+			k_spin_unlock(wait_q->lock, obj_key);
+		}
+
+		k_spin_unlock(&sched_spinlock, sched_key);
+		arch_spin_relax();
+	}
+}
+#endif
+
 ALWAYS_INLINE void z_unpend_thread_no_timeout(struct k_thread *thread)
 {
+	if (waitq_obj_locked(thread->base.pended_on)) {
+		/* The caller holds the object lock */
+		waitq_remove(thread);
+		return;
+	}
+
 	K_SPINLOCK(&sched_spinlock) {
 		if (thread->base.pended_on != NULL) {
 			unpend_thread_no_timeout(thread);
@@ -790,6 +1256,11 @@ ALWAYS_INLINE void z_unpend_thread_no_timeout(struct k_thread *thread)
 
 void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
 {
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	k_spinlock_key_t obj_key = {};
+	struct k_spinlock *obj_lock = pended_on_lock(thread, &obj_key);
+#endif
+
 	K_SPINLOCK(&sched_spinlock) {
 		bool killed = ((thread->base.thread_state & _THREAD_DEAD) ||
 			       (thread->base.thread_state & _THREAD_ABORTING));
@@ -817,6 +1288,11 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
 		}
 	}
 
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	if (obj_lock != NULL) {
+		k_spin_unlock(obj_lock, obj_key);
+	}
+#endif
 }
 
 #ifdef CONFIG_SYS_CLOCK_EXISTS
@@ -861,6 +1337,7 @@ int z_pend_curr(struct k_spinlock *lock, k_spinlock_key_t key,
 	pending_current = _current;
 #endif
 	__ASSERT_NO_MSG(sizeof(sched_spinlock) == 0 || lock != &sched_spinlock);
+	__ASSERT_NO_MSG(!waitq_obj_locked(wait_q) || wait_q->lock == lock);
 
 	/* We do a "lock swap" prior to calling z_swap(), such that
 	 * the caller's lock gets released as desired.  But we ensure
@@ -880,6 +1357,8 @@ struct k_thread *z_unpend1_no_timeout(_wait_q_t *wait_q)
 {
 	struct k_thread *thread = NULL;
 
+	__ASSERT_NO_MSG(!waitq_obj_locked(wait_q));
+
 	K_SPINLOCK(&sched_spinlock) {
 		thread = _priq_wait_best(&wait_q->waitq);
 
@@ -895,6 +1374,18 @@ struct k_thread *z_unpend_first_thread(_wait_q_t *wait_q)
 {
 	struct k_thread *thread = NULL;
 
+	if (waitq_obj_locked(wait_q)) {
+		/* The caller holds the object lock */
+		thread = _priq_wait_best(&wait_q->waitq);
+
+		if (thread != NULL) {
+			waitq_remove(thread);
+			(void)z_abort_thread_timeout(thread);
+		}
+
+		return thread;
+	}
+
 	K_SPINLOCK(&sched_spinlock) {
 		thread = _priq_wait_best(&wait_q->waitq);
 
@@ -1101,13 +1592,16 @@ void *z_get_next_switch_handle(void *interrupted)
 		new_thread = next_up();
 
 		z_sched_usage_switch(new_thread);
+		z_sched_runq_latency_record(new_thread);
 
 		if (old_thread != new_thread) {
+			z_sched_runq_latency_switch_out(old_thread);
 			update_metairq_preempt(new_thread);
 			z_sched_switch_spin(new_thread);
 			arch_cohere_stacks(old_thread, interrupted, new_thread);
 
 			_current_cpu->swap_ok = 0;
+			new_thread->base.cpu = arch_curr_cpu()->id;
 			set_current(new_thread);
 
 #ifdef CONFIG_TIMESLICING
@@ -1144,6 +1638,11 @@ void *z_get_next_switch_handle(void *interrupted)
 	return ret;
 #else
 	z_sched_usage_switch(_kernel.ready_q.cache);
+	z_sched_runq_latency_record(_kernel.ready_q.cache);
+	if (_kernel.ready_q.cache != _current) {
+		z_sched_runq_latency_switch_out(_current);
+	}
+	z_sched_cbs_switch(_kernel.ready_q.cache);
 	_current->switch_handle = interrupted;
 	set_current(_kernel.ready_q.cache);
 	return _current->switch_handle;
@@ -1299,7 +1798,7 @@ void init_ready_q(struct _ready_q *rq)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(rq->runq.queues); i++) {
 		sys_dlist_init(&rq->runq.queues[i]);
 	}
 #else
@@ -1309,7 +1808,7 @@ void init_ready_q(struct _ready_q *rq)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
@@ -1389,6 +1888,63 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 }
 #include <syscalls/k_thread_deadline_set_mrsh.c>
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+int z_impl_k_thread_cbs_set(k_tid_t tid, uint32_t budget, uint32_t period)
+{
+	struct k_thread *thread = tid;
+	uint32_t util = cbs_util(budget, period);
+	int ret = 0;
+
+	if ((budget != 0U) && ((budget > period) || (period > INT32_MAX))) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&sched_spinlock) {
+		uint32_t old_util = cbs_util(thread->base.cbs.budget,
+					     thread->base.cbs.period);
+
+		if ((cbs_total_util - old_util + util) >
+		    (CONFIG_SCHED_DEADLINE_CBS_MAX_UTIL * 10000U)) {
+			ret = -EBUSY;
+			K_SPINLOCK_BREAK;
+		}
+
+		cbs_detach(thread);
+		if (budget == 0U) {
+			K_SPINLOCK_BREAK;
+		}
+
+		cbs_total_util += util;
+		thread->base.cbs.budget = budget;
+		thread->base.cbs.period = period;
+		thread->base.cbs.remaining = (int32_t)budget;
+		thread->base.prio_deadline = k_cycle_get_32() + period;
+
+		if (z_is_thread_queued(thread)) {
+			dequeue_thread(thread);
+			queue_thread(thread);
+		}
+		if (thread == _current) {
+			z_sched_cbs_switch(thread);
+		}
+		update_cache(0);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_cbs_set(k_tid_t tid, uint32_t budget,
+					  uint32_t period)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(tid, K_OBJ_THREAD));
+
+	return z_impl_k_thread_cbs_set(tid, budget, period);
+}
+#include <syscalls/k_thread_cbs_set_mrsh.c>
+#endif
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 #endif
 
 bool k_can_yield(void)
@@ -1717,7 +2273,16 @@ static void end_thread(struct k_thread *thread)
 		if (thread->base.pended_on != NULL) {
 			unpend_thread_no_timeout(thread);
 		}
+		if (IS_ENABLED(CONFIG_WAITQ_OBJ_LOCK)) {
+			/* May have been taken off an object-locked
+			 * wait queue but not readied yet
+			 */
+			z_mark_thread_as_not_pending(thread);
+		}
 		(void)z_abort_thread_timeout(thread);
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		cbs_detach(thread);
+#endif
 		unpend_all(&thread->join_queue);
 		update_cache(1);
 
@@ -1742,9 +2307,40 @@ static void end_thread(struct k_thread *thread)
 	}
 }
 
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+/* Takes sched_spinlock with the thread off any object-locked wait queue.
+ * The object lock nests outside sched_spinlock, so end_thread() can't
+ * unpend from such a queue itself: do it first, and again if the thread
+ * ran and pended anew before we got the lock.
+ */
+static k_spinlock_key_t sched_lock_unpended(struct k_thread *thread)
+{
+	k_spinlock_key_t key;
+	struct k_spinlock *obj_lock;
+
+	while (true) {
+		obj_lock = pended_on_lock(thread, &key);
+		if (obj_lock != NULL) {
+			waitq_remove(thread);
+			k_spin_unlock(obj_lock, key);
+		}
+
+		key = k_spin_lock(&sched_spinlock);
+		if (!waitq_obj_locked(thread->base.pended_on)) {
+			return key;
+		}
+		k_spin_unlock(&sched_spinlock, key);
+	}
+}
+#endif
+
 void z_thread_abort(struct k_thread *thread)
 {
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	k_spinlock_key_t key = sched_lock_unpended(thread);
+#else
 	k_spinlock_key_t key = k_spin_lock(&sched_spinlock);
+#endif
 
 	if ((thread->base.user_options & K_ESSENTIAL) != 0) {
 		k_spin_unlock(&sched_spinlock, key);
@@ -1912,6 +2508,8 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	struct k_thread *thread;
 	bool ret = false;
 
+	__ASSERT_NO_MSG(!waitq_obj_locked(wait_q));
+
 	K_SPINLOCK(&sched_spinlock) {
 		thread = _priq_wait_best(&wait_q->waitq);
 
@@ -1940,27 +2538,42 @@ int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 	return ret;
 }
 
-int z_sched_waitq_walk(_wait_q_t  *wait_q,
-		       int (*func)(struct k_thread *, void *), void *data)
+static int waitq_walk(_wait_q_t *wait_q,
+		      int (*func)(struct k_thread *, void *), void *data)
 {
 	struct k_thread *thread;
 	int  status = 0;
 
-	K_SPINLOCK(&sched_spinlock) {
-		_WAIT_Q_FOR_EACH(wait_q, thread) {
+	_WAIT_Q_FOR_EACH(wait_q, thread) {
 
-			/*
-			 * Invoke the callback function on each waiting thread
-			 * for as long as there are both waiting threads AND
-			 * it returns 0.
-			 */
+		/*
+		 * Invoke the callback function on each waiting thread
+		 * for as long as there are both waiting threads AND
+		 * it returns 0.
+		 */
 
-			status = func(thread, data);
-			if (status != 0) {
-				break;
-			}
+		status = func(thread, data);
+		if (status != 0) {
+			break;
 		}
 	}
 
 	return status;
 }
+
+int z_sched_waitq_walk(_wait_q_t  *wait_q,
+		       int (*func)(struct k_thread *, void *), void *data)
+{
+	int  status = 0;
+
+	if (waitq_obj_locked(wait_q)) {
+		/* The caller holds the object lock */
+		return waitq_walk(wait_q, func, data);
+	}
+
+	K_SPINLOCK(&sched_spinlock) {
+		status = waitq_walk(wait_q, func, data);
+	}
+
+	return status;
+}
@@ -35,9 +35,26 @@
  * significant extra RAM.  A properly spin-aware semaphore
  * implementation would spin on atomic access to the count variable,
  * and not a spinlock per se.  Useful optimization for the future...
+ *
+ * With CONFIG_WAITQ_OBJ_LOCK each semaphore has its own lock, which
+ * also protects its wait queue.
  */
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+static inline struct k_spinlock *sem_lock(struct k_sem *sem)
+{
+	return &sem->lock;
+}
+#else
 static struct k_spinlock lock;
 
+static inline struct k_spinlock *sem_lock(struct k_sem *sem)
+{
+	ARG_UNUSED(sem);
+
+	return &lock;
+}
+#endif
+
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		      unsigned int limit)
 {
@@ -52,10 +69,13 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 	sem->count = initial_count;
 	sem->limit = limit;
+#ifdef CONFIG_WAITQ_OBJ_LOCK
+	sem->lock = (struct k_spinlock) {};
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
 
-	z_waitq_init(&sem->wait_q);
+	z_waitq_init_locked(&sem->wait_q, sem_lock(sem));
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&sem->poll_events);
 #endif
@@ -87,7 +107,7 @@ static inline bool handle_poll_events(struct k_sem *sem)
 
 void z_impl_k_sem_give(struct k_sem *sem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(sem_lock(sem));
 	struct k_thread *thread;
 	bool resched = true;
 
@@ -104,9 +124,9 @@ void z_impl_k_sem_give(struct k_sem *sem)
 	}
 
 	if (resched) {
-		z_reschedule(&lock, key);
+		z_reschedule(sem_lock(sem), key);
 	} else {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(sem_lock(sem), key);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give, sem);
@@ -121,6 +141,36 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 #include <syscalls/k_sem_give_mrsh.c>
 #endif
 
+#ifdef CONFIG_SEM_ADAPTIVE_SPIN
+/*
+ * Called with the lock held on an unavailable semaphore.  Unless
+ * somebody is already pended on it (and would be given it first), poll
+ * for it to be given for up to CONFIG_ADAPTIVE_SPIN_NS before the caller
+ * pends.  Returns with the lock held again; the caller re-checks the
+ * count.
+ */
+static k_spinlock_key_t sem_adaptive_spin(struct k_sem *sem,
+					  k_spinlock_key_t key)
+{
+	uint32_t budget = k_ns_to_cyc_ceil32(CONFIG_ADAPTIVE_SPIN_NS);
+	uint32_t start;
+
+	if (z_waitq_head(&sem->wait_q) != NULL) {
+		return key;
+	}
+
+	k_spin_unlock(sem_lock(sem), key);
+
+	start = k_cycle_get_32();
+	while ((*(volatile unsigned int *)&sem->count == 0U) &&
+	       ((k_cycle_get_32() - start) < budget)) {
+		arch_spin_relax();
+	}
+
+	return k_spin_lock(sem_lock(sem));
+}
+#endif /* CONFIG_SEM_ADAPTIVE_SPIN */
+
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret = 0;
@@ -128,26 +178,32 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(sem_lock(sem));
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
 
+#ifdef CONFIG_SEM_ADAPTIVE_SPIN
+	if ((sem->count == 0U) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		key = sem_adaptive_spin(sem, key);
+	}
+#endif /* CONFIG_SEM_ADAPTIVE_SPIN */
+
 	if (likely(sem->count > 0U)) {
 		sem->count--;
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(sem_lock(sem), key);
 		ret = 0;
 		goto out;
 	}
 
 	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
-		k_spin_unlock(&lock, key);
+		k_spin_unlock(sem_lock(sem), key);
 		ret = -EBUSY;
 		goto out;
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
-	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
+	ret = z_pend_curr(sem_lock(sem), key, &sem->wait_q, timeout);
 
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
@@ -158,7 +214,7 @@ out:
 void z_impl_k_sem_reset(struct k_sem *sem)
 {
 	struct k_thread *thread;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(sem_lock(sem));
 
 	while (true) {
 		thread = z_unpend_first_thread(&sem->wait_q);
@@ -174,7 +230,7 @@ void z_impl_k_sem_reset(struct k_sem *sem)
 
 	handle_poll_events(sem);
 
-	z_reschedule(&lock, key);
+	z_reschedule(sem_lock(sem), key);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -277,8 +277,8 @@ const char *k_thread_state_str(k_tid_t thread_id, char *buf, size_t buf_size)
 	uint8_t     thread_state = thread_id->base.thread_state;
 	static const char  *states_str[8] = {"dummy", "pending", "prestart",
 					     "dead", "suspended", "aborting",
-					     "", "queued"};
-	static const size_t states_sz[8] = {5, 7, 8, 4, 9, 8, 0, 6};
+					     "throttled", "queued"};
+	static const size_t states_sz[8] = {5, 7, 8, 4, 9, 8, 9, 6};
 
 	if ((buf == NULL) || (buf_size == 0)) {
 		return "";
@@ -814,6 +814,12 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 	thread_base->slice_expired = NULL;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	thread_base->cbs.budget = 0U;
+	thread_base->cbs.period = 0U;
+	z_init_timeout(&thread_base->cbs.timer);
+#endif
+
 	/* swap_data does not need to be initialized */
 
 	z_init_thread_timeout(thread_base);
@@ -1051,6 +1057,14 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif
 
+#if defined(CONFIG_SCHED_RUNQ_LATENCY) && !defined(CONFIG_USE_SWITCH)
+	z_sched_runq_latency_record(_current);
+#endif
+
+#if defined(CONFIG_SCHED_DEADLINE_CBS) && !defined(CONFIG_USE_SWITCH)
+	z_sched_cbs_switch(_current);
+#endif
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif
@@ -1062,6 +1076,13 @@ void z_thread_mark_switched_out(void)
 	z_sched_usage_stop();
 #endif
 
+#if defined(CONFIG_SCHED_RUNQ_LATENCY) && !defined(CONFIG_USE_SWITCH)
+	/* The arch swap code switches to the cached next thread */
+	if (_kernel.ready_q.cache != _current) {
+		z_sched_runq_latency_switch_out(_current);
+	}
+#endif
+
 #ifdef CONFIG_TRACING
 #ifdef CONFIG_THREAD_LOCAL_STORAGE
 	/* Dummy thread won't have TLS set up to run arbitrary code */
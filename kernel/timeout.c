@@ -11,10 +11,32 @@
 #include <zephyr/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* Each level of the wheel has 64 slots, so a single 64 bit word
+ * tracks which of them are non-empty.
+ */
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS BIT(WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SPAN_BITS (WHEEL_BITS * WHEEL_LEVELS)
+
+struct wheel_level {
+	uint64_t pending;
+	sys_dlist_t slots[WHEEL_SLOTS];
+};
+
+static struct wheel_level wheel[WHEEL_LEVELS];
+
+/* Timeouts beyond the range of the top level, rescanned on wrap */
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -36,6 +58,173 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* With the wheel backend, _timeout.dticks holds the absolute tick at
+ * which the timeout expires.  A timeout lives on the level given by
+ * the most significant 6-bit digit in which its expiry differs from
+ * curr_tick, in the slot indexed by its own digit at that level.
+ * Because every pending expiry is in the future, all non-empty slots
+ * of a level lie at or after curr_tick's digit, and a timeout only
+ * changes level when curr_tick reaches the start of its slot, at
+ * which point wheel_cascade() redistributes the whole slot.
+ */
+static int wheel_level_of(uint64_t expiry)
+{
+	uint64_t diff = expiry ^ curr_tick;
+
+	if ((diff >> WHEEL_SPAN_BITS) != 0U) {
+		return WHEEL_LEVELS;
+	}
+
+	if (diff == 0U) {
+		return 0;
+	}
+
+	return (63 - u64_count_leading_zeros(diff)) / WHEEL_BITS;
+}
+
+static inline uint32_t wheel_slot_of(uint64_t expiry, int level)
+{
+	return (expiry >> (level * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+static void wheel_insert(struct _timeout *to)
+{
+	int level = wheel_level_of(to->dticks);
+	struct wheel_level *lvl;
+	uint32_t slot;
+
+	if (level == WHEEL_LEVELS) {
+		sys_dlist_append(&wheel_overflow, &to->node);
+		return;
+	}
+
+	lvl = &wheel[level];
+	slot = wheel_slot_of(to->dticks, level);
+
+	/* Slot lists are (re)initialized lazily when they become
+	 * non-empty, the pending mask is the source of truth.
+	 */
+	if ((lvl->pending & BIT64(slot)) == 0U) {
+		sys_dlist_init(&lvl->slots[slot]);
+		lvl->pending |= BIT64(slot);
+	}
+
+	sys_dlist_append(&lvl->slots[slot], &to->node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	int level = wheel_level_of(t->dticks);
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		uint32_t slot = wheel_slot_of(t->dticks, level);
+
+		if (sys_dlist_is_empty(&wheel[level].slots[slot])) {
+			wheel[level].pending &= ~BIT64(slot);
+		}
+	}
+}
+
+/* Reinsert every timeout of a list relative to the current curr_tick */
+static void wheel_reinsert(sys_dlist_t *list)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Detach all timeouts of a slot onto a temporary list */
+static void wheel_take_slot(int level, uint32_t slot, sys_dlist_t *out)
+{
+	struct wheel_level *lvl = &wheel[level];
+	sys_dnode_t *node;
+
+	if ((lvl->pending & BIT64(slot)) == 0U) {
+		return;
+	}
+
+	lvl->pending &= ~BIT64(slot);
+	while ((node = sys_dlist_get(&lvl->slots[slot])) != NULL) {
+		sys_dlist_append(out, node);
+	}
+}
+
+/* Called each time curr_tick lands on a new tick: moves down the
+ * contents of every slot that starts at this tick.  Higher levels go
+ * first so their timeouts can trickle all the way down in one pass.
+ */
+static void wheel_cascade(void)
+{
+	sys_dlist_t tmp;
+
+	sys_dlist_init(&tmp);
+
+	if ((curr_tick & BIT64_MASK(WHEEL_SPAN_BITS)) == 0U) {
+		sys_dnode_t *node;
+
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&tmp, node);
+		}
+		wheel_reinsert(&tmp);
+	}
+
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		if ((curr_tick & BIT64_MASK(level * WHEEL_BITS)) == 0U) {
+			wheel_take_slot(level, wheel_slot_of(curr_tick, level),
+					&tmp);
+			wheel_reinsert(&tmp);
+		}
+	}
+}
+
+/* Tick of the next wheel event, either an expiry on level 0 or the
+ * start of the earliest non-empty slot of a higher level, which is
+ * where that slot gets cascaded.  Lower levels always hold earlier
+ * events than higher ones.
+ */
+static bool wheel_next_event(uint64_t *when)
+{
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		uint64_t pending = wheel[level].pending;
+
+		if (pending != 0U) {
+			int shift = level * WHEEL_BITS;
+			uint64_t slot = u64_count_trailing_zeros(pending);
+
+			*when = ((curr_tick >> (shift + WHEEL_BITS))
+				 << (shift + WHEEL_BITS)) | (slot << shift);
+			return true;
+		}
+	}
+
+	if (!sys_dlist_is_empty(&wheel_overflow)) {
+		*when = ((curr_tick >> WHEEL_SPAN_BITS) + 1U) << WHEEL_SPAN_BITS;
+		return true;
+	}
+
+	return false;
+}
+
+/* Next timeout expiring exactly at curr_tick, if any */
+static struct _timeout *wheel_expired(void)
+{
+	uint32_t slot = wheel_slot_of(curr_tick, 0);
+	sys_dnode_t *t;
+
+	if ((wheel[0].pending & BIT64(slot)) == 0U) {
+		return NULL;
+	}
+
+	t = sys_dlist_peek_head(&wheel[0].slots[slot]);
+
+	return CONTAINER_OF(t, struct _timeout, node);
+}
+#else
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -58,6 +247,7 @@ static void remove_timeout(struct _timeout *t)
 
 	sys_dlist_remove(&t->node);
 }
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 static int32_t elapsed(void)
 {
@@ -82,16 +272,33 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(void)
 {
-	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	uint64_t when;
+	int64_t dt;
+
+	if (!wheel_next_event(&when)) {
+		return MAX_WAIT;
+	}
+
+	dt = (int64_t)(when - curr_tick) - ticks_elapsed;
+	if (dt > (int64_t)INT_MAX) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, (int32_t)dt);
+	}
+#else
+	struct _timeout *to = first();
+
 	if ((to == NULL) ||
 	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
 		ret = MAX(0, to->dticks - ticks_elapsed);
 	}
+#endif
 
 	return ret;
 }
@@ -111,8 +318,6 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
@@ -122,6 +327,20 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+		uint64_t prev, when;
+		bool had_next = wheel_next_event(&prev);
+
+		to->dticks += curr_tick;
+		wheel_insert(to);
+
+		(void)wheel_next_event(&when);
+		if (!had_next || (when < prev)) {
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+#else
+		struct _timeout *t;
+
 		for (t = first(); t != NULL; t = next(t)) {
 			if (t->dticks > to->dticks) {
 				t->dticks -= to->dticks;
@@ -138,6 +357,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		if (to == first()) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
+#endif
 	}
 }
 
@@ -164,12 +384,16 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 		return 0;
 	}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	ticks = timeout->dticks - curr_tick;
+#else
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
 			break;
 		}
 	}
+#endif
 
 	return ticks - elapsed();
 }
@@ -224,6 +448,30 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	uint64_t when;
+
+	while (wheel_next_event(&when) &&
+	       ((when - curr_tick) <= (uint64_t)announce_remaining)) {
+		int dt = when - curr_tick;
+
+		curr_tick = when;
+		announce_remaining -= dt;
+
+		if (dt != 0) {
+			wheel_cascade();
+		}
+
+		for (struct _timeout *t = wheel_expired(); t != NULL;
+		     t = wheel_expired()) {
+			remove_timeout(t);
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+	}
+#else
 	struct _timeout *t;
 
 	for (t = first();
@@ -244,6 +492,7 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -329,7 +578,36 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	/* Expiries are absolute, shift them along with the tick count
+	 * so pending timeouts keep their remaining time.
+	 */
+	K_SPINLOCK(&timeout_lock) {
+		sys_dlist_t tmp;
+		sys_dnode_t *node;
+
+		sys_dlist_init(&tmp);
+		for (int level = 0; level < WHEEL_LEVELS; level++) {
+			for (uint32_t slot = 0; slot < WHEEL_SLOTS; slot++) {
+				wheel_take_slot(level, slot, &tmp);
+			}
+		}
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&tmp, node);
+		}
+
+		SYS_DLIST_FOR_EACH_NODE(&tmp, node) {
+			struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+			t->dticks += tick - curr_tick;
+		}
+
+		curr_tick = tick;
+		wheel_reinsert(&tmp);
+	}
+#else
 	curr_tick = tick;
+#endif
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -219,6 +219,9 @@ void z_sched_thread_usage(struct k_thread *thread,
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_FPU
+	arch_thread_fpu_usage(thread, &stats->fp_saves, &stats->fp_traps);
 #endif
 	stats->execution_cycles = thread->base.usage.total;
 
@@ -229,6 +229,156 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+static inline bool work_is_flusher(const struct k_work *work)
+{
+	return work->handler == handle_flush;
+}
+
+/* Test whether a pool worker is refusing new work.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool pool_queue_closed_locked(const struct k_work_q *queue)
+{
+	return (flags_get(&queue->flags)
+		& (K_WORK_QUEUE_DRAIN | K_WORK_QUEUE_PLUGGED)) != 0U;
+}
+
+/* Choose the worker of a pool that should receive a new item.
+ *
+ * Workers that are draining or plugged are skipped.  A worker
+ * submitting to its own pool keeps the item, otherwise the first idle
+ * worker at or after the round-robin cursor is used, or the first open
+ * one if none is idle.  If all are closed, the item goes to the
+ * submitting worker, which accepts it while draining, or to the worker
+ * at the cursor, which refuses it.
+ *
+ * Invoked with work lock held.
+ */
+static struct k_work_q *pool_pick_locked(struct k_work_pool *pool)
+{
+	struct k_work_q *queue = NULL;
+	struct k_work_q *open = NULL;
+	struct k_work_q *self = NULL;
+	uint32_t n = pool->num_queues;
+
+	for (uint32_t i = 0; i < n; i++) {
+		struct k_work_q *wq = &pool->queues[(pool->next + i) % n];
+
+		if ((_current == &wq->thread) && !k_is_in_isr()) {
+			self = wq;
+		}
+
+		if (pool_queue_closed_locked(wq)) {
+			continue;
+		}
+
+		if (wq == self) {
+			return wq;
+		}
+
+		if (open == NULL) {
+			open = wq;
+		}
+
+		if ((queue == NULL) && sys_slist_is_empty(&wq->pending)
+		    && !flag_test(&wq->flags, K_WORK_QUEUE_BUSY_BIT)) {
+			queue = wq;
+		}
+	}
+
+	if (queue == NULL) {
+		queue = open;
+	}
+
+	if (queue == NULL) {
+		return (self != NULL) ? self : &pool->queues[pool->next];
+	}
+
+	pool->next = ((uint32_t)(queue - pool->queues) + 1U) % n;
+
+	return queue;
+}
+
+/* Move the oldest stealable item of a sibling worker to an idle
+ * worker, along with the flushers queued right behind it.
+ *
+ * The head of a sibling can't be stolen if it is a flusher, which must
+ * run on the worker running the item it waits for, or if it was
+ * resubmitted while running, as it must not run concurrently with
+ * itself.  Nothing is stolen by or for a draining or plugged worker.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the idle worker.
+ *
+ * @return true if and only if work was moved to @p queue.
+ */
+static bool pool_steal_locked(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+	uint32_t n = pool->num_queues;
+	uint32_t self = (uint32_t)(queue - pool->queues);
+
+	if (pool_queue_closed_locked(queue)) {
+		return false;
+	}
+
+	for (uint32_t i = 1; i < n; i++) {
+		struct k_work_q *victim = &pool->queues[(self + i) % n];
+		sys_snode_t *node = sys_slist_peek_head(&victim->pending);
+		struct k_work *work;
+
+		if ((node == NULL) || pool_queue_closed_locked(victim)) {
+			continue;
+		}
+
+		work = CONTAINER_OF(node, struct k_work, node);
+		if (work_is_flusher(work)
+		    || flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+			continue;
+		}
+
+		do {
+			(void)sys_slist_get(&victim->pending);
+			sys_slist_append(&queue->pending, node);
+			node = sys_slist_peek_head(&victim->pending);
+		} while ((node != NULL)
+			 && work_is_flusher(CONTAINER_OF(node, struct k_work,
+							 node)));
+
+		work->queue = queue;
+
+		return true;
+	}
+
+	return false;
+}
+
+/* Wake one idle sibling of a worker that has more pending work, so it
+ * can steal some.
+ *
+ * Invoked with work lock held.
+ */
+static void pool_wake_idle_locked(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+	uint32_t n = pool->num_queues;
+	uint32_t self = (uint32_t)(queue - pool->queues);
+
+	for (uint32_t i = 1; i < n; i++) {
+		struct k_work_q *wq = &pool->queues[(self + i) % n];
+
+		if (!pool_queue_closed_locked(wq) && notify_queue_locked(wq)) {
+			break;
+		}
+	}
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Submit an work item to a queue if queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
@@ -412,6 +562,54 @@ int k_work_submit(struct k_work *work)
 	return ret;
 }
 
+int k_work_submit_batch(struct k_work_q *queue,
+			struct k_work **works, size_t num_works)
+{
+	int queued = 0;
+	int err = 0;
+
+	__ASSERT_NO_MSG((works != NULL) || (num_works == 0U));
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, submit_batch, queue, works,
+					num_works);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < num_works; i++) {
+		struct k_work_q *wq = queue;
+
+		__ASSERT_NO_MSG(works[i] != NULL);
+
+		/* A queue thread is woken at most once: it can't take
+		 * the lock to run anything before we are done, so later
+		 * notifications find nobody waiting and are cheap.
+		 */
+		int ret = submit_to_queue_locked(works[i], &wq);
+
+		if (ret > 0) {
+			queued++;
+		} else if ((ret < 0) && (err == 0)) {
+			err = ret;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	/* One reschedule for the whole batch, see
+	 * k_work_submit_to_queue().
+	 */
+	if (queued > 0) {
+		z_reschedule_unlocked();
+	}
+
+	int ret = ((queued == 0) && (err != 0)) ? err : queued;
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, submit_batch, queue, works,
+				       num_works, ret);
+
+	return ret;
+}
+
 /* Flush the work item if necessary.
  *
  * Flushing is necessary only if the work is either queued or running.
@@ -609,6 +807,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 		/* Check for and prepare any new work. */
 		node = sys_slist_get(&queue->pending);
+#ifdef CONFIG_WORKQUEUE_POOL
+		if ((node == NULL) && (queue->pool != NULL)
+		    && pool_steal_locked(queue)) {
+			node = sys_slist_get(&queue->pending);
+		}
+#endif
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
@@ -631,6 +835,13 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+			if ((queue->pool != NULL)
+			    && !sys_slist_is_empty(&queue->pending)) {
+				pool_wake_idle_locked(queue);
+			}
+#endif
 		} else if (flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
@@ -703,19 +914,18 @@ void k_work_queue_init(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_INIT(k_work_queue, queue);
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+/* Set up a work queue and create its thread, without starting it. */
+static void work_queue_create(struct k_work_q *queue,
+			      k_thread_stack_t *stack,
+			      size_t stack_size,
+			      int prio,
+			      const struct k_work_queue_config *cfg)
 {
 	__ASSERT_NO_MSG(queue);
 	__ASSERT_NO_MSG(stack);
 	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
 	uint32_t flags = K_WORK_QUEUE_STARTED;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
-
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
@@ -737,7 +947,17 @@ void k_work_queue_start(struct k_work_q *queue,
 	if ((cfg != NULL) && (cfg->name != NULL)) {
 		k_thread_name_set(&queue->thread, cfg->name);
 	}
+}
 
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	work_queue_create(queue, stack, stack_size, prio, cfg);
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
@@ -795,6 +1015,131 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+void k_work_pool_start(struct k_work_pool *pool, int prio,
+		       const struct k_work_pool_config *cfg)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(pool->num_queues > 0U);
+
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		struct k_work_q *queue = &pool->queues[i];
+		k_thread_stack_t *stack = (k_thread_stack_t *)
+			((uint8_t *)pool->stacks + (i * pool->stack_stride));
+		struct k_work_queue_config qcfg = {
+			.no_yield = (cfg != NULL) && cfg->no_yield,
+		};
+#ifdef CONFIG_THREAD_NAME
+		char name[CONFIG_THREAD_MAX_NAME_LEN];
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			snprintk(name, sizeof(name), "%s.%u", cfg->name, i);
+			qcfg.name = name;
+		}
+#endif
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+		k_work_queue_init(queue);
+		queue->pool = pool;
+		work_queue_create(queue, stack, pool->stack_size, prio, &qcfg);
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((cfg != NULL) && cfg->pin_cpus) {
+			(void)k_thread_cpu_pin(&queue->thread,
+					       i % arch_num_cpus());
+		}
+#endif
+
+		k_thread_start(&queue->thread);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+	}
+}
+
+int k_work_pool_submit(struct k_work_pool *pool, struct k_work *work)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(work != NULL);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, pool_submit, pool, work);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_work_q *queue = pool_pick_locked(pool);
+	int ret = submit_to_queue_locked(work, &queue);
+
+	k_spin_unlock(&lock, key);
+
+	/* See k_work_submit_to_queue() */
+	if (ret > 0) {
+		z_reschedule_unlocked();
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, pool_submit, pool, work, ret);
+
+	return ret;
+}
+
+int k_work_pool_drain(struct k_work_pool *pool, bool plug)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(!k_is_in_isr());
+
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Plug every worker before waiting on any of them, so nothing is
+	 * stolen from or handed to a worker that has already drained.
+	 */
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		struct k_work_q *queue = &pool->queues[i];
+
+		if (((flags_get(&queue->flags)
+		      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
+		    || !sys_slist_is_empty(&queue->pending)) {
+			ret = 1;
+		}
+
+		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
+		flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
+		notify_queue_locked(queue);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		int rc = k_work_queue_drain(&pool->queues[i], true);
+
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	if (!plug) {
+		(void)k_work_pool_unplug(pool);
+	}
+
+	return ret;
+}
+
+int k_work_pool_unplug(struct k_work_pool *pool)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	int ret = -EALREADY;
+
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		if (k_work_queue_unplug(&pool->queues[i]) == 0) {
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
 /* Timeout handler for delayable work.
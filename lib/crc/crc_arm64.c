@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* ARMv8 hardware CRC hooks, using the crc32 and crc32c instructions of
+ * the CRC32 extension.  Both work on general purpose registers only.
+ */
+
+#include <zephyr/sys/util.h>
+
+#include "crc_internal.h"
+
+#define CRC_INSN(insn, crc, v, reg)					\
+	__asm__ (".arch_extension crc\n\t"				\
+		 insn " %w0, %w0, %" reg "1" : "+r"(crc) : "r"(v))
+
+static inline size_t crc_hw(uint32_t *crc, const uint8_t *data, size_t len,
+			    bool castagnoli)
+{
+	uint32_t c = *crc;
+	size_t n = len;
+
+	for (; (n > 0) && (((uintptr_t)data & 7) != 0); n--, data++) {
+		if (castagnoli) {
+			CRC_INSN("crc32cb", c, *data, "w");
+		} else {
+			CRC_INSN("crc32b", c, *data, "w");
+		}
+	}
+
+	for (; n >= 8; n -= 8, data += 8) {
+		uint64_t v = *(const uint64_t *)data;
+
+		if (castagnoli) {
+			CRC_INSN("crc32cx", c, v, "x");
+		} else {
+			CRC_INSN("crc32x", c, v, "x");
+		}
+	}
+
+	for (; n > 0; n--, data++) {
+		if (castagnoli) {
+			CRC_INSN("crc32cb", c, *data, "w");
+		} else {
+			CRC_INSN("crc32b", c, *data, "w");
+		}
+	}
+
+	*crc = c;
+
+	return len;
+}
+
+size_t crc32_ieee_hw(uint32_t *crc, const uint8_t *data, size_t len)
+{
+	return crc_hw(crc, data, len, false);
+}
+
+size_t crc32c_hw(uint32_t *crc, const uint8_t *data, size_t len)
+{
+	return crc_hw(crc, data, len, true);
+}
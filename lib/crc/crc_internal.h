@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Private interfaces shared by the CRC implementations.
+ *
+ * All helpers below work on the raw CRC register: any initial value,
+ * inversion or final XOR is applied by the public functions.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC_INTERNAL_H_
+#define ZEPHYR_LIB_CRC_CRC_INTERNAL_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <zephyr/sys/byteorder.h>
+
+#ifdef CONFIG_CRC_SW_SLICE_BY_8
+
+extern const uint32_t crc32_ieee_slice8_table[8][256];
+extern const uint32_t crc32c_slice8_table[8][256];
+extern const uint16_t crc16_ccitt_slice8_table[8][256];
+
+/* Reflected 32-bit CRC, eight bytes per step. */
+static inline uint32_t crc32_slice8(const uint32_t table[8][256],
+				    uint32_t crc, const uint8_t *data,
+				    size_t len)
+{
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t lo = sys_get_le32(data) ^ crc;
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc = table[7][lo & 0xff] ^
+		      table[6][(lo >> 8) & 0xff] ^
+		      table[5][(lo >> 16) & 0xff] ^
+		      table[4][lo >> 24] ^
+		      table[3][hi & 0xff] ^
+		      table[2][(hi >> 8) & 0xff] ^
+		      table[1][(hi >> 16) & 0xff] ^
+		      table[0][hi >> 24];
+	}
+
+	for (; len > 0; len--) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+	}
+
+	return crc;
+}
+
+/* Reflected 16-bit CRC, eight bytes per step. */
+static inline uint16_t crc16_slice8(const uint16_t table[8][256],
+				    uint16_t crc, const uint8_t *data,
+				    size_t len)
+{
+	for (; len >= 8; len -= 8, data += 8) {
+		uint16_t lo = sys_get_le16(data) ^ crc;
+
+		crc = table[7][lo & 0xff] ^
+		      table[6][lo >> 8] ^
+		      table[5][data[2]] ^
+		      table[4][data[3]] ^
+		      table[3][data[4]] ^
+		      table[2][data[5]] ^
+		      table[1][data[6]] ^
+		      table[0][data[7]];
+	}
+
+	for (; len > 0; len--) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+	}
+
+	return crc;
+}
+
+#endif /* CONFIG_CRC_SW_SLICE_BY_8 */
+
+/* Hardware CRC hooks.  Each processes as much of the buffer as the
+ * instructions allow, updates *crc and returns the number of bytes
+ * consumed; the caller handles the rest in software.
+ */
+
+#if defined(CONFIG_CRC_HW_X86_PCLMUL) || defined(CONFIG_CRC_HW_ARM64)
+#define CRC32_IEEE_HW 1
+size_t crc32_ieee_hw(uint32_t *crc, const uint8_t *data, size_t len);
+#endif
+
+#if defined(CONFIG_CRC_HW_X86_SSE42) || defined(CONFIG_CRC_HW_ARM64)
+#define CRC32C_HW 1
+size_t crc32c_hw(uint32_t *crc, const uint8_t *data, size_t len);
+#endif
+
+#endif /* ZEPHYR_LIB_CRC_CRC_INTERNAL_H_ */
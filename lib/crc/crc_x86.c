@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* x86 hardware CRC hooks.
+ *
+ * CRC32C uses the SSE4.2 crc32 instruction, which works on general
+ * purpose registers only.  CRC32-IEEE folds 16 byte blocks with
+ * PCLMULQDQ carry-less multiplication as described in Intel's "Fast CRC
+ * Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+ * Only the latter touches XMM registers, so only it has a thread
+ * context switch cost, see CONFIG_CRC_HW_X86_PCLMUL.
+ */
+
+#include <zephyr/sys/util.h>
+
+#include "crc_internal.h"
+
+#ifdef CONFIG_CRC_HW_X86_SSE42
+
+static inline uint32_t crc32c_u8(uint32_t crc, uint8_t v)
+{
+	__asm__ ("crc32b %1, %0" : "+r"(crc) : "rm"(v));
+	return crc;
+}
+
+#ifdef CONFIG_64BIT
+static inline uint32_t crc32c_u64(uint32_t crc, uint64_t v)
+{
+	uint64_t c = crc;
+
+	__asm__ ("crc32q %1, %0" : "+r"(c) : "rm"(v));
+	return (uint32_t)c;
+}
+#else
+static inline uint32_t crc32c_u32(uint32_t crc, uint32_t v)
+{
+	__asm__ ("crc32l %1, %0" : "+r"(crc) : "rm"(v));
+	return crc;
+}
+#endif
+
+size_t crc32c_hw(uint32_t *crc, const uint8_t *data, size_t len)
+{
+	uint32_t c = *crc;
+	size_t n = len;
+
+	/* x86 handles the unaligned loads, but not crossing cache lines
+	 * is cheaper.
+	 */
+	for (; (n > 0) && (((uintptr_t)data & 7) != 0); n--) {
+		c = crc32c_u8(c, *data++);
+	}
+
+#ifdef CONFIG_64BIT
+	for (; n >= 8; n -= 8, data += 8) {
+		c = crc32c_u64(c, UNALIGNED_GET((const uint64_t *)data));
+	}
+#else
+	for (; n >= 4; n -= 4, data += 4) {
+		c = crc32c_u32(c, UNALIGNED_GET((const uint32_t *)data));
+	}
+#endif
+
+	for (; n > 0; n--) {
+		c = crc32c_u8(c, *data++);
+	}
+
+	*crc = c;
+
+	return len;
+}
+
+#endif /* CONFIG_CRC_HW_X86_SSE42 */
+
+#ifdef CONFIG_CRC_HW_X86_PCLMUL
+
+#include <immintrin.h>
+
+#define CRC_PCLMUL __attribute__((target("pclmul,sse2")))
+
+/* Folding constants for the reflected polynomial 0x104c11db7:
+ * R1 = x^(4*128+32) mod P, R2 = x^(4*128-32) mod P,
+ * R3 = x^(128+32) mod P,   R4 = x^(128-32) mod P,
+ * R5 = x^64 mod P, P' and u' the Barrett reduction constants, all
+ * bit-reflected and shifted left by one.
+ */
+#define CRC32_K1K2 _mm_set_epi64x(0x00000001c6e41596ULL, 0x0000000154442bd4ULL)
+#define CRC32_K3K4 _mm_set_epi64x(0x00000000ccaa009eULL, 0x00000001751997d0ULL)
+#define CRC32_K5 _mm_set_epi64x(0, 0x0000000163cd6124ULL)
+#define CRC32_PU _mm_set_epi64x(0x00000001f7011641ULL, 0x00000001db710641ULL)
+
+CRC_PCLMUL static inline __m128i fold(__m128i x, __m128i k, __m128i next)
+{
+	__m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+
+	return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+CRC_PCLMUL size_t crc32_ieee_hw(uint32_t *crc, const uint8_t *data,
+				size_t len)
+{
+	const __m128i mask32 = _mm_set_epi32(0, 0, 0, ~0);
+	__m128i x0, x1, x2, x3, k;
+	size_t n = len;
+
+	/* Below 64 bytes the setup costs more than the tables */
+	if (n < 64) {
+		return 0;
+	}
+
+	x0 = _mm_loadu_si128((const __m128i *)data);
+	x1 = _mm_loadu_si128((const __m128i *)(data + 16));
+	x2 = _mm_loadu_si128((const __m128i *)(data + 32));
+	x3 = _mm_loadu_si128((const __m128i *)(data + 48));
+	x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128((int)*crc));
+	data += 64;
+	n -= 64;
+
+	/* Fold 64 bytes at a time into four accumulators */
+	k = CRC32_K1K2;
+	for (; n >= 64; n -= 64, data += 64) {
+		x0 = fold(x0, k, _mm_loadu_si128((const __m128i *)data));
+		x1 = fold(x1, k, _mm_loadu_si128((const __m128i *)(data + 16)));
+		x2 = fold(x2, k, _mm_loadu_si128((const __m128i *)(data + 32)));
+		x3 = fold(x3, k, _mm_loadu_si128((const __m128i *)(data + 48)));
+	}
+
+	/* Fold the accumulators into one, then 16 bytes at a time */
+	k = CRC32_K3K4;
+	x0 = fold(x0, k, x1);
+	x0 = fold(x0, k, x2);
+	x0 = fold(x0, k, x3);
+	for (; n >= 16; n -= 16, data += 16) {
+		x0 = fold(x0, k, _mm_loadu_si128((const __m128i *)data));
+	}
+
+	/* 128 to 64 bits, appending 32 zero bits */
+	x0 = _mm_xor_si128(_mm_clmulepi64_si128(k, x0, 0x01),
+			   _mm_srli_si128(x0, 8));
+
+	/* 64 to 32 bits */
+	x1 = _mm_srli_si128(x0, 4);
+	x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), CRC32_K5, 0x00);
+	x0 = _mm_xor_si128(x0, x1);
+
+	/* Barrett reduction */
+	k = CRC32_PU;
+	x1 = x0;
+	x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), k, 0x10);
+	x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), k, 0x00);
+	x0 = _mm_xor_si128(x0, x1);
+
+	*crc = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x0, 4));
+
+	return len - n;
+}
+
+#endif /* CONFIG_CRC_HW_X86_PCLMUL */
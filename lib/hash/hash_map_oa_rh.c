@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_oa_rh.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Robin Hood hashing is linear probing with one extra rule: while probing
+ * for a free slot, an entry that is closer to its home bucket than the
+ * entry being inserted gives up its slot and continues probing instead.
+ * This keeps the variance of probe lengths low, which in turn lets
+ * lookups stop as soon as they meet an entry closer to home than the key
+ * being searched for, and lets removal shift the following entries back
+ * rather than leaving tombstones behind.
+ */
+
+struct oarh_entry {
+	uint64_t key;
+	uint64_t value;
+	/* distance from the home bucket plus one, zero when the slot is empty */
+	uint32_t dist;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_rh_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_rh_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_rh_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static struct oarh_entry *sys_hashmap_oa_rh_find(const struct sys_hashmap *map, uint64_t key)
+{
+	struct oarh_entry *entry;
+	const size_t n_buckets = map->data->n_buckets;
+	struct oarh_entry *const buckets = map->data->buckets;
+	uint32_t hash;
+
+	if (n_buckets == 0) {
+		return NULL;
+	}
+
+	hash = map->hash_func(&key, sizeof(key));
+
+	for (size_t i = 0, j = hash; i < n_buckets; ++i, ++j) {
+		j &= (n_buckets - 1);
+		entry = &buckets[j];
+
+		/*
+		 * Had the key been present, it would have displaced any entry
+		 * closer to its home bucket than i + 1.
+		 */
+		if (entry->dist < i + 1) {
+			return NULL;
+		}
+
+		if (entry->key == key) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void sys_hashmap_oa_rh_insert_no_rehash(struct sys_hashmap *map, uint64_t key,
+					       uint64_t value)
+{
+	struct oarh_entry tmp;
+	struct oarh_entry *entry;
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+	const size_t n_buckets = data->n_buckets;
+	struct oarh_entry *const buckets = data->buckets;
+	struct oarh_entry ins = {
+		.key = key,
+		.value = value,
+		.dist = 1,
+	};
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	__ASSERT_NO_MSG(data->size < n_buckets);
+
+	for (size_t j = hash;; ++j, ++ins.dist) {
+		j &= (n_buckets - 1);
+		entry = &buckets[j];
+
+		if (entry->dist == 0) {
+			*entry = ins;
+			break;
+		}
+
+		if (entry->dist < ins.dist) {
+			tmp = *entry;
+			*entry = ins;
+			ins = tmp;
+		}
+	}
+
+	++data->size;
+}
+
+static int sys_hashmap_oa_rh_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_buckets;
+	size_t new_n_buckets = 0;
+	struct oarh_entry *entry;
+	struct oarh_entry *old_buckets;
+	struct oarh_entry *new_buckets;
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, 0, &new_n_buckets)) {
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	/* extract all entries from the hashmap */
+	old_size = data->size;
+	old_n_buckets = data->n_buckets;
+	old_buckets = (struct oarh_entry *)data->buckets;
+
+	new_buckets = (struct oarh_entry *)map->alloc_func(NULL, new_n_buckets * sizeof(*entry));
+	if (new_buckets == NULL && new_n_buckets != 0) {
+		return -ENOMEM;
+	}
+
+	if (new_buckets != NULL) {
+		/* ensure all buckets are empty / initialized */
+		memset(new_buckets, 0, new_n_buckets * sizeof(*new_buckets));
+	}
+
+	data->size = 0;
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_buckets && j < old_size; ++i) {
+		entry = &old_buckets[i];
+
+		if (entry->dist != 0) {
+			sys_hashmap_oa_rh_insert_no_rehash(map, entry->key, entry->value);
+			++j;
+		}
+	}
+
+	/* free the old Hashmap */
+	map->alloc_func(old_buckets, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_oa_rh_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	struct oarh_entry *entry;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct oarh_entry *buckets = map->data->buckets;
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = buckets;
+	}
+
+	i = (struct oarh_entry *)it->state - buckets;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		entry = &buckets[i];
+		if (entry->dist != 0) {
+			it->state = &buckets[i + 1];
+			it->key = entry->key;
+			it->value = entry->value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Open Addressing / Robin Hood Hashmap API
+ */
+
+static void sys_hashmap_oa_rh_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_oa_rh_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_oa_rh_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct oarh_entry *entry;
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+	struct oarh_entry *buckets = data->buckets;
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		entry = &buckets[i];
+		if (entry->dist != 0) {
+			cb(entry->key, entry->value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static int sys_hashmap_oa_rh_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				    uint64_t *old_value)
+{
+	int ret;
+	struct oarh_entry *entry;
+
+	/* replacing a value never changes the layout, so skip the rehash check */
+	entry = sys_hashmap_oa_rh_find(map, key);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+		entry->value = value;
+		return 0;
+	}
+
+	ret = sys_hashmap_oa_rh_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sys_hashmap_oa_rh_insert_no_rehash(map, key, value);
+
+	return 1;
+}
+
+static bool sys_hashmap_oa_rh_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct oarh_entry *entry;
+	struct oarh_entry *next;
+	struct sys_hashmap_oa_rh_data *data = (struct sys_hashmap_oa_rh_data *)map->data;
+	struct oarh_entry *const buckets = data->buckets;
+	const size_t n_buckets = data->n_buckets;
+	size_t j;
+
+	entry = sys_hashmap_oa_rh_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	/*
+	 * Backward-shift deletion: pull each following displaced entry one
+	 * slot closer to its home bucket until an empty slot or an entry
+	 * already in its home bucket is reached.
+	 */
+	for (j = entry - buckets;; j = (j + 1) & (n_buckets - 1)) {
+		entry = &buckets[j];
+		next = &buckets[(j + 1) & (n_buckets - 1)];
+
+		if (next->dist <= 1) {
+			entry->dist = 0;
+			break;
+		}
+
+		*entry = *next;
+		--entry->dist;
+	}
+
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_oa_rh_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_oa_rh_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct oarh_entry *entry;
+
+	entry = sys_hashmap_oa_rh_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_oa_rh_api = {
+	.iter = sys_hashmap_oa_rh_iter,
+	.clear = sys_hashmap_oa_rh_clear,
+	.insert = sys_hashmap_oa_rh_insert,
+	.remove = sys_hashmap_oa_rh_remove,
+	.get = sys_hashmap_oa_rh_get,
+};
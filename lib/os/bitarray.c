@@ -26,6 +26,155 @@ struct bundle_data {
 	uint32_t smask, emask;
 };
 
+/*
+ * Bring the summary bits of a range of bundles up to date after the
+ * bundles were modified.
+ *
+ * @param bitarray Bitarray struct
+ * @param sidx     Index of the first modified bundle
+ * @param eidx     Index of the last modified bundle
+ */
+static inline void update_summary(sys_bitarray_t *bitarray,
+				  size_t sidx, size_t eidx)
+{
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	for (size_t idx = sidx; idx <= eidx; idx++) {
+		uint32_t bit = BIT(idx % 32);
+
+		if (bitarray->bundles[idx] == ~0U) {
+			bitarray->full_bundles[idx / 32] |= bit;
+		} else {
+			bitarray->full_bundles[idx / 32] &= ~bit;
+		}
+	}
+#else
+	ARG_UNUSED(bitarray);
+	ARG_UNUSED(sidx);
+	ARG_UNUSED(eidx);
+#endif
+}
+
+/*
+ * Find the first bundle at or after idx which is not fully allocated.
+ *
+ * @return Index of the bundle, or bitarray->num_bundles if there is none.
+ */
+static size_t next_free_bundle(sys_bitarray_t *bitarray, size_t idx)
+{
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	size_t sidx = idx / 32;
+	size_t num_summary = DIV_ROUND_UP(bitarray->num_bundles, 32);
+	uint32_t free_mask;
+
+	if (idx >= bitarray->num_bundles) {
+		return bitarray->num_bundles;
+	}
+
+	/* Bundles below idx in the first summary word don't count */
+	free_mask = ~bitarray->full_bundles[sidx] & ~(BIT(idx % 32) - 1U);
+
+	while (free_mask == 0U) {
+		if (++sidx >= num_summary) {
+			return bitarray->num_bundles;
+		}
+		free_mask = ~bitarray->full_bundles[sidx];
+	}
+
+	return MIN(sidx * 32 + find_lsb_set(free_mask) - 1,
+		   bitarray->num_bundles);
+#else
+	while ((idx < bitarray->num_bundles) &&
+	       (bitarray->bundles[idx] == ~0U)) {
+		idx++;
+	}
+
+	return idx;
+#endif
+}
+
+/*
+ * Find the first run of cleared bits long enough for an allocation.
+ *
+ * This walks the bundles one at a time: free bundles extend the current
+ * run by a whole bundle, full bundles are skipped (using the summary
+ * bitmap if enabled) and partially allocated bundles are split into
+ * their runs of cleared and set bits with find_lsb_set().
+ *
+ * @param[in]  bitarray Bitarray struct
+ * @param[in]  num_bits Number of bits to find
+ * @param[out] offset   Offset of the first bit of the run
+ *
+ * @retval true  If a run was found
+ * @retval false If there is no such run
+ */
+static bool find_clear_region(sys_bitarray_t *bitarray, size_t num_bits,
+			      size_t *offset)
+{
+	const size_t bitness = bundle_bitness(bitarray);
+	size_t run_start = 0;
+	size_t run_len = 0;
+	size_t idx = 0;
+
+	while (idx < bitarray->num_bundles) {
+		uint32_t bundle = bitarray->bundles[idx];
+		size_t base = idx * bitness;
+		size_t pos = 0;
+
+		if (bundle == ~0U) {
+			/* Full, the run is broken */
+			run_len = 0;
+			idx = next_free_bundle(bitarray, idx + 1);
+			continue;
+		}
+
+		while (pos < bitness) {
+			uint32_t rest = bundle >> pos;
+			size_t zeros, ones;
+
+			/* Cleared bits from pos: up to the next set bit, or to
+			 * the end of the bundle.
+			 */
+			zeros = (rest == 0U) ? (bitness - pos) :
+					       (find_lsb_set(rest) - 1);
+			if (zeros > 0) {
+				if (run_len == 0) {
+					run_start = base + pos;
+				}
+				run_len += zeros;
+				if (run_len >= num_bits) {
+					goto found;
+				}
+				pos += zeros;
+			}
+
+			if (pos >= bitness) {
+				break;
+			}
+
+			/* Set bits from pos, these break the run.  As
+			 * rest has a zero above its top valid bit, its
+			 * complement is never zero.
+			 */
+			ones = find_lsb_set(~(bundle >> pos)) - 1;
+			pos += ones;
+			run_len = 0;
+		}
+
+		idx++;
+	}
+
+	return false;
+
+found:
+	/* Bits past num_bits in the last bundle are always clear */
+	if ((run_start + num_bits) > bitarray->num_bits) {
+		return false;
+	}
+
+	*offset = run_start;
+	return true;
+}
+
 static void setup_bundle_data(sys_bitarray_t *bitarray,
 			      struct bundle_data *bd,
 			      size_t offset, size_t num_bits)
@@ -208,6 +357,8 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 			}
 		}
 	}
+
+	update_summary(bitarray, bd->sidx, bd->eidx);
 }
 
 int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
@@ -230,6 +381,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -258,6 +410,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -334,6 +487,7 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	}
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -373,6 +527,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -385,11 +540,8 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
 {
 	k_spinlock_key_t key;
-	uint32_t bit_idx;
+	size_t bit_idx;
 	int ret;
-	struct bundle_data bd;
-	size_t off_start, off_end;
-	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -406,46 +558,13 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
-	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
-
-	off_end = bitarray->num_bits - num_bits;
-	ret = -ENOSPC;
-	while (bit_idx <= off_end) {
-		if (match_region(bitarray, bit_idx, num_bits, false,
-				 &bd, &mismatch)) {
-			set_region(bitarray, bit_idx, num_bits, true, &bd);
-
-			*offset = bit_idx;
-			ret = 0;
-			break;
-		}
+	if (find_clear_region(bitarray, num_bits, &bit_idx)) {
+		set_region(bitarray, bit_idx, num_bits, true, NULL);
 
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
-		 */
-		bit_idx = mismatch + 1;
+		*offset = bit_idx;
+		ret = 0;
+	} else {
+		ret = -ENOSPC;
 	}
 
 out:
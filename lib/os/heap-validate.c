@@ -83,6 +83,16 @@ static void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	/* Fast-binned chunks look used but are accounted as free */
+	for (chunksz_t sz = 1U; sz <= FAST_BIN_MAX_CHUNKS; sz++) {
+		for (c = h->fast_bins[sz]; c != 0U; c = next_free_chunk(h, c)) {
+			*alloc_bytes -= chunksz_to_bytes(h, sz);
+			*free_bytes += chunksz_to_bytes(h, sz);
+		}
+	}
+#endif
 }
 
 bool sys_heap_validate(struct sys_heap *heap)
@@ -102,6 +112,18 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	/* Fast bins hold valid, used-marked chunks of their exact size */
+	for (chunksz_t sz = 1U; sz <= FAST_BIN_MAX_CHUNKS; sz++) {
+		for (c = h->fast_bins[sz]; c != 0U; c = next_free_chunk(h, c)) {
+			if (!valid_chunk(h, c) || !chunk_used(h, c) ||
+			    (chunk_size(h, c) != sz)) {
+				return false;
+			}
+		}
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
@@ -148,6 +148,57 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+static void fast_bin_push(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	CHECK(chunk_used(h, c));
+
+	set_next_free_chunk(h, c, h->fast_bins[sz]);
+	h->fast_bins[sz] = c;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+}
+
+static chunkid_t fast_bin_pop(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = h->fast_bins[sz];
+
+	if (c != 0U) {
+		h->fast_bins[sz] = next_free_chunk(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+	}
+
+	return c;
+}
+
+/* Give every fast-binned chunk back to the regular free lists,
+ * coalescing as usual.  Returns true if anything was released.
+ */
+static bool fast_bins_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (chunksz_t sz = 1U; sz <= FAST_BIN_MAX_CHUNKS; sz++) {
+		chunkid_t c;
+
+		while ((c = fast_bin_pop(h, sz)) != 0U) {
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+			flushed = true;
+		}
+	}
+
+	return flushed;
+}
+#endif
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -184,7 +235,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +244,14 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	if (chunk_size(h, c) <= FAST_BIN_MAX_CHUNKS) {
+		fast_bin_push(h, c);
+		return;
+	}
+#endif
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -270,18 +328,34 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
-	if (c == 0U) {
-		return NULL;
-	}
+	chunkid_t c = 0U;
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	/* Exact size hit: the chunk is still marked used, hand it out */
+	if (chunk_sz <= FAST_BIN_MAX_CHUNKS) {
+		c = fast_bin_pop(h, chunk_sz);
 	}
+#endif
 
-	set_chunk_used(h, c, true);
+	if (c == 0U) {
+		c = alloc_chunk(h, chunk_sz);
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+		if ((c == 0U) && fast_bins_flush(h)) {
+			c = alloc_chunk(h, chunk_sz);
+		}
+#endif
+		if (c == 0U) {
+			return NULL;
+		}
+
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
+
+		set_chunk_used(h, c, true);
+	}
 
 	mem = chunk_mem(h, c);
 
@@ -335,6 +409,12 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	if ((c0 == 0) && fast_bins_flush(h)) {
+		c0 = alloc_chunk(h, padded_sz);
+	}
+#endif
+
 	if (c0 == 0) {
 		return NULL;
 	}
@@ -527,6 +607,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	for (int i = 0; i < ARRAY_SIZE(h->fast_bins); i++) {
+		h->fast_bins[i] = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -65,6 +65,15 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+/* Largest chunk size (header included, whatever the header size)
+ * that gets a fast bin.  Bins are indexed by chunk size, index 0 is
+ * unused.
+ */
+#define FAST_BIN_MAX_CHUNKS \
+	((CONFIG_SYS_HEAP_FAST_BIN_MAX_SIZE + 8U + CHUNK_UNIT - 1U) / CHUNK_UNIT)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +82,12 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	/* LIFO lists of freed chunks linked through FREE_NEXT.  Chunks in
+	 * there stay marked used so nothing coalesces with them.
+	 */
+	chunkid_t fast_bins[FAST_BIN_MAX_CHUNKS + 1];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -135,6 +135,12 @@ static inline uint32_t idx_inc(struct mpsc_pbuf_buffer *buffer,
 	return (i >= buffer->size) ? i - buffer->size : i;
 }
 
+static inline uint32_t idx_dist(struct mpsc_pbuf_buffer *buffer,
+				uint32_t from, uint32_t to)
+{
+	return (to >= from) ? to - from : buffer->size - from + to;
+}
+
 static inline uint32_t get_skip(union mpsc_pbuf_generic *item)
 {
 	if (item->hdr.busy && !item->hdr.valid) {
@@ -209,9 +215,6 @@ static bool drop_item_locked(struct mpsc_pbuf_buffer *buffer,
 			add_skip_item(buffer, free_wlen);
 			MPSC_PBUF_DBG(buffer, "no space: Added skip packet (len:%d)", free_wlen);
 		}
-		/* Move all indexes forward, after claimed packet. */
-		buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, rd_wlen);
-
 		/* If allocation wrapped around the buffer and found busy packet
 		 * that was already ommited, skip it again.
 		 */
@@ -219,6 +222,12 @@ static bool drop_item_locked(struct mpsc_pbuf_buffer *buffer,
 			buffer->tmp_rd_idx = idx_inc(buffer, buffer->tmp_rd_idx, rd_wlen);
 		}
 
+		/* Move all indexes forward, after claimed packets. There may be
+		 * more than one if they were claimed with mpsc_pbuf_claim_many().
+		 */
+		buffer->wr_idx = idx_inc(buffer, buffer->wr_idx,
+					 idx_dist(buffer, buffer->rd_idx, buffer->tmp_rd_idx));
+
 		buffer->tmp_wr_idx = buffer->tmp_rd_idx;
 		buffer->rd_idx = buffer->tmp_rd_idx;
 		buffer->flags |= MPSC_PBUF_FULL;
@@ -525,57 +534,99 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 	} while (cont);
 }
 
+/* Claim the packet at tmp_rd_idx. Returns null and sets *cont if a skip or
+ * dropped packet was consumed and the caller should try again. If skip_ok
+ * is false such a packet is left in place and null is returned instead.
+ */
+static union mpsc_pbuf_generic *claim_locked(struct mpsc_pbuf_buffer *buffer,
+					     bool skip_ok, bool *cont)
+{
+	union mpsc_pbuf_generic *item;
+	uint32_t a;
+
+	*cont = false;
+	(void)available(buffer, &a);
+	item = (union mpsc_pbuf_generic *)
+		&buffer->buf[buffer->tmp_rd_idx];
+
+	if (!a || is_invalid(item)) {
+		MPSC_PBUF_DBG(buffer, "invalid claim %d: %p", a, item);
+		return NULL;
+	}
+
+	uint32_t skip = get_skip(item);
+
+	if (skip || !is_valid(item)) {
+		if (!skip_ok) {
+			return NULL;
+		}
+
+		uint32_t inc =
+			skip ? skip : buffer->get_wlen(item);
+
+		buffer->tmp_rd_idx =
+		      idx_inc(buffer, buffer->tmp_rd_idx, inc);
+		rd_idx_inc(buffer, inc);
+		*cont = true;
+		return NULL;
+	}
+
+	item->hdr.busy = 1;
+	buffer->tmp_rd_idx =
+		idx_inc(buffer, buffer->tmp_rd_idx,
+			buffer->get_wlen(item));
+
+	MPSC_PBUF_DBG(buffer, ">>claimed %d: %p", a, item);
+
+	return item;
+}
+
 const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer)
 {
 	union mpsc_pbuf_generic *item;
 	bool cont;
 
 	do {
-		uint32_t a;
 		k_spinlock_key_t key;
 
-		cont = false;
 		key = k_spin_lock(&buffer->lock);
-		(void)available(buffer, &a);
-		item = (union mpsc_pbuf_generic *)
-			&buffer->buf[buffer->tmp_rd_idx];
-
-		if (!a || is_invalid(item)) {
-			MPSC_PBUF_DBG(buffer, "invalid claim %d: %p", a, item);
-			item = NULL;
-		} else {
-			uint32_t skip = get_skip(item);
-
-			if (skip || !is_valid(item)) {
-				uint32_t inc =
-					skip ? skip : buffer->get_wlen(item);
-
-				buffer->tmp_rd_idx =
-				      idx_inc(buffer, buffer->tmp_rd_idx, inc);
-				rd_idx_inc(buffer, inc);
-				cont = true;
-			} else {
-				item->hdr.busy = 1;
-				buffer->tmp_rd_idx =
-					idx_inc(buffer, buffer->tmp_rd_idx,
-						buffer->get_wlen(item));
-			}
-		}
-
-		if (!cont) {
-			MPSC_PBUF_DBG(buffer, ">>claimed %d: %p", a, item);
-		}
+		item = claim_locked(buffer, true, &cont);
 		k_spin_unlock(&buffer->lock, key);
 	} while (cont);
 
 	return item;
 }
 
-void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
-		     const union mpsc_pbuf_generic *item)
+size_t mpsc_pbuf_claim_many(struct mpsc_pbuf_buffer *buffer,
+			    const union mpsc_pbuf_generic **packets,
+			    size_t max)
+{
+	union mpsc_pbuf_generic *item;
+	k_spinlock_key_t key;
+	size_t n = 0;
+	bool cont;
+
+	key = k_spin_lock(&buffer->lock);
+	while (n < max) {
+		/* Skip and dropped packets move rd_idx, which must stay at the
+		 * first claimed packet until it is freed, so stop the run there.
+		 */
+		item = claim_locked(buffer, n == 0, &cont);
+		if (item) {
+			packets[n++] = item;
+		} else if (!cont) {
+			break;
+		}
+	}
+	k_spin_unlock(&buffer->lock, key);
+
+	return n;
+}
+
+static void free_locked(struct mpsc_pbuf_buffer *buffer,
+			const union mpsc_pbuf_generic *item)
 {
 	uint32_t wlen = buffer->get_wlen(item);
-	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
 	union mpsc_pbuf_generic *witem = (union mpsc_pbuf_generic *)item;
 
 	witem->hdr.valid = 0;
@@ -598,7 +649,32 @@ void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 		witem->skip.len = wlen;
 	}
 	MPSC_PBUF_DBG(buffer, "<<freed: %p", item);
+}
 
+void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
+		     const union mpsc_pbuf_generic *item)
+{
+	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+	free_locked(buffer, item);
+
+	k_spin_unlock(&buffer->lock, key);
+	k_sem_give(&buffer->sem);
+}
+
+void mpsc_pbuf_free_many(struct mpsc_pbuf_buffer *buffer,
+			 const union mpsc_pbuf_generic **packets, size_t n)
+{
+	k_spinlock_key_t key;
+
+	if (n == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&buffer->lock);
+	for (size_t i = 0; i < n; i++) {
+		free_locked(buffer, packets[i]);
+	}
 	k_spin_unlock(&buffer->lock, key);
 	k_sem_give(&buffer->sem);
 }
@@ -42,10 +42,10 @@ int ring_buf_put_finish(struct ring_buf *buf, uint32_t size)
 		return -EINVAL;
 	}
 
-	buf->put_tail += size;
-	buf->put_head = buf->put_tail;
+	buf->put_head = buf->put_tail + size;
+	ring_buf_internal_store(&buf->put_tail, buf->put_head);
 
-	wrap_size = buf->put_tail - buf->put_base;
+	wrap_size = buf->put_head - buf->put_base;
 	if (unlikely(wrap_size >= buf->size)) {
 		/* we wrapped: adjust put_base */
 		buf->put_base += buf->size;
@@ -109,10 +109,10 @@ int ring_buf_get_finish(struct ring_buf *buf, uint32_t size)
 		return -EINVAL;
 	}
 
-	buf->get_tail += size;
-	buf->get_head = buf->get_tail;
+	buf->get_head = buf->get_tail + size;
+	ring_buf_internal_store(&buf->get_tail, buf->get_head);
 
-	wrap_size = buf->get_tail - buf->get_base;
+	wrap_size = buf->get_head - buf->get_base;
 	if (unlikely(wrap_size >= buf->size)) {
 		/* we wrapped: adjust get_base */
 		buf->get_base += buf->size;
@@ -241,6 +241,15 @@ static bool pthread_attr_is_valid(const struct pthread_attr *attr)
 	return true;
 }
 
+/* Free a thread's dynamic stack, unless it is kept for the next user */
+static void posix_thread_stack_release(struct posix_thread *t)
+{
+	if (!IS_ENABLED(CONFIG_PTHREAD_REUSE_STACKS) && (t->dynamic_stack != NULL)) {
+		(void)k_thread_stack_free(t->dynamic_stack);
+		t->dynamic_stack = NULL;
+	}
+}
+
 static void posix_thread_recycle_work_handler(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -325,10 +334,7 @@ static void posix_thread_recycle(void)
 
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD)) {
 		SYS_DLIST_FOR_EACH_CONTAINER(&recyclables, t, q_node) {
-			if (t->dynamic_stack != NULL) {
-				(void)k_thread_stack_free(t->dynamic_stack);
-				t->dynamic_stack = NULL;
-			}
+			posix_thread_stack_release(t);
 		}
 	}
 
@@ -350,7 +356,7 @@ static void posix_thread_recycle(void)
 int pthread_create(pthread_t *th, const pthread_attr_t *_attr, void *(*threadroutine)(void *),
 		   void *arg)
 {
-	int err;
+	int err = 0;
 	k_spinlock_key_t key;
 	pthread_barrier_t barrier;
 	struct posix_thread *t = NULL;
@@ -364,11 +370,6 @@ int pthread_create(pthread_t *th, const pthread_attr_t *_attr, void *(*threadrou
 	if (attr == NULL) {
 		attr = &attr_storage;
 		attr->stacksize = DYNAMIC_STACK_SIZE;
-		attr->stack =
-			k_thread_stack_alloc(attr->stacksize, k_is_user_context() ? K_USER : 0);
-		if (attr->stack == NULL) {
-			return EAGAIN;
-		}
 	} else {
 		__ASSERT_NO_MSG(attr != &attr_storage);
 	}
@@ -389,7 +390,6 @@ int pthread_create(pthread_t *th, const pthread_attr_t *_attr, void *(*threadrou
 		}
 		t->cancel_pending = false;
 		sys_slist_init(&t->key_list);
-		t->dynamic_stack = _attr == NULL ? attr->stack : NULL;
 	}
 	k_spin_unlock(&pthread_pool_lock, key);
 
@@ -398,23 +398,36 @@ int pthread_create(pthread_t *th, const pthread_attr_t *_attr, void *(*threadrou
 		return EAGAIN;
 	}
 
-	if (IS_ENABLED(CONFIG_PTHREAD_CREATE_BARRIER)) {
-		err = pthread_barrier_init(&barrier, NULL, 2);
-		if (err != 0) {
-			if (t->dynamic_stack != NULL) {
-				(void)k_thread_stack_free(attr->stack);
-			}
+	if (_attr == NULL) {
+		/* reuse the stack kept from the thread's previous life, if any */
+		if (t->dynamic_stack == NULL) {
+			t->dynamic_stack = k_thread_stack_alloc(attr->stacksize,
+								k_is_user_context() ? K_USER : 0);
+		}
 
-			/* cannot allocate barrier. move thread back to ready_q */
-			key = k_spin_lock(&pthread_pool_lock);
-			sys_dlist_remove(&t->q_node);
-			sys_dlist_append(&ready_q, &t->q_node);
-			t->qid = POSIX_THREAD_READY_Q;
-			k_spin_unlock(&pthread_pool_lock, key);
-			t = NULL;
+		attr->stack = t->dynamic_stack;
+		if (attr->stack == NULL) {
+			err = EAGAIN;
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_PTHREAD_CREATE_BARRIER) && (err == 0)) {
+		err = pthread_barrier_init(&barrier, NULL, 2);
+	}
+
+	if (err != 0) {
+		/* cannot allocate a stack or barrier. move thread back to ready_q */
+		posix_thread_stack_release(t);
+
+		key = k_spin_lock(&pthread_pool_lock);
+		sys_dlist_remove(&t->q_node);
+		sys_dlist_append(&ready_q, &t->q_node);
+		t->qid = POSIX_THREAD_READY_Q;
+		k_spin_unlock(&pthread_pool_lock, key);
+
+		return err;
+	}
+
 	/* spawn the thread */
 	k_thread_create(&t->thread, attr->stack, attr->stacksize, zephyr_thread_wrapper,
 			(void *)arg, threadroutine,
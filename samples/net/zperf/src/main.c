@@ -27,7 +27,7 @@ int main(void)
 	(void)net_config_init_app(NULL, "Initializing network");
 #endif /* CONFIG_USB_DEVICE_STACK */
 #ifdef CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DROP
-	loopback_set_packet_drop_ratio(1);
+	loopback_set_packet_drop_ratio(CONFIG_NET_SAMPLE_LOOPBACK_DROP_PERMILLE / 1000.0f);
 #endif
 	return 0;
 }
@@ -141,6 +141,7 @@ static char tag[CONFIG_LOG_TAG_MAX_LEN + 1] =
 	COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, ({}), (CONFIG_LOG_TAG_DEFAULT));
 
 static void msg_process(union log_msg_generic *msg);
+static bool msg_claim_oldest_needed(void);
 
 static log_timestamp_t dummy_timestamp(void)
 {
@@ -459,6 +460,26 @@ static void msg_process(union log_msg_generic *msg)
 	}
 }
 
+#define LOG_PROCESS_BATCH_MAX \
+	COND_CODE_1(CONFIG_LOG_PROCESS_THREAD, (CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE), (1))
+
+static void msg_process_batch(size_t max_msgs)
+{
+#ifdef CONFIG_MPSC_PBUF
+	const union mpsc_pbuf_generic *batch[LOG_PROCESS_BATCH_MAX];
+	size_t n;
+
+	n = mpsc_pbuf_claim_many(&log_buffer, batch, MIN(max_msgs, ARRAY_SIZE(batch)));
+	atomic_sub(&buffered_cnt, n);
+
+	for (size_t i = 0; i < n; i++) {
+		msg_process((union log_msg_generic *)batch[i]);
+	}
+
+	mpsc_pbuf_free_many(&log_buffer, batch, n);
+#endif
+}
+
 void dropped_notify(void)
 {
 	uint32_t dropped = z_log_dropped_read_and_clear();
@@ -494,7 +515,11 @@ static inline bool z_log_unordered_pending(void)
 	return IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && unordered_cnt;
 }
 
-bool z_impl_log_process(void)
+/* Process up to max_msgs messages. When more than one message is requested
+ * and there is only the local buffer, messages are claimed and freed in a
+ * single step, which saves a buffer lock round trip per message.
+ */
+static bool process(size_t max_msgs)
 {
 	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
 		return false;
@@ -507,20 +532,25 @@ bool z_impl_log_process(void)
 		return false;
 	}
 
-	msg = z_log_msg_claim(&backoff);
-
-	if (msg) {
-		atomic_dec(&buffered_cnt);
-		msg_process(msg);
-		z_log_msg_free(msg);
-	} else if (CONFIG_LOG_PROCESSING_LATENCY_US > 0 && !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
-		/* If backoff is requested, it means that there are pending
-		 * messages but they are too new and processing shall back off
-		 * to allow arrival of newer messages from remote domains.
-		 */
-		k_timer_start(&log_process_thread_timer, backoff, K_NO_WAIT);
+	if (max_msgs > 1 && !msg_claim_oldest_needed()) {
+		msg_process_batch(max_msgs);
+	} else {
+		msg = z_log_msg_claim(&backoff);
+
+		if (msg) {
+			atomic_dec(&buffered_cnt);
+			msg_process(msg);
+			z_log_msg_free(msg);
+		} else if (CONFIG_LOG_PROCESSING_LATENCY_US > 0 &&
+			   !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
+			/* If backoff is requested, it means that there are pending
+			 * messages but they are too new and processing shall back off
+			 * to allow arrival of newer messages from remote domains.
+			 */
+			k_timer_start(&log_process_thread_timer, backoff, K_NO_WAIT);
 
-		return false;
+			return false;
+		}
 	}
 
 	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -544,6 +574,11 @@ bool z_impl_log_process(void)
 	return z_log_msg_pending();
 }
 
+bool z_impl_log_process(void)
+{
+	return process(1);
+}
+
 #ifdef CONFIG_USERSPACE
 bool z_vrfy_log_process(void)
 {
@@ -705,14 +740,19 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 	return msg;
 }
 
-union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
+static bool msg_claim_oldest_needed(void)
 {
 	size_t len;
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	return IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1;
+}
+
+union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
+{
+	if (msg_claim_oldest_needed()) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -891,7 +931,7 @@ static void log_process_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 
 
-		if (log_process() == false) {
+		if (process(LOG_PROCESS_BATCH_MAX) == false) {
 			if (processed_any) {
 				processed_any = false;
 				log_backend_notify_all(LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
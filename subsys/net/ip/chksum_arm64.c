@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* ARMv8 internet checksum hook.
+ *
+ * Pairs of 32-bit words are added to 64-bit lanes with one pairwise
+ * add and accumulate long per 16 byte block, so no carry is lost.
+ */
+
+#include <zephyr/sys/util.h>
+#include <arm_neon.h>
+
+#include "net_private.h"
+
+size_t net_chksum_hw(uint64_t *sum, const uint8_t *data, size_t len)
+{
+	uint64x2_t acc0 = vdupq_n_u64(0);
+	uint64x2_t acc1 = vdupq_n_u64(0);
+	uint64x2_t acc2 = vdupq_n_u64(0);
+	uint64x2_t acc3 = vdupq_n_u64(0);
+	size_t n = len;
+
+	/* Below 64 bytes the setup costs more than it saves */
+	if (n < 64) {
+		return 0;
+	}
+
+	for (; n >= 64; n -= 64, data += 64) {
+		acc0 = vpadalq_u32(acc0, vld1q_u32((const uint32_t *)data));
+		acc1 = vpadalq_u32(acc1, vld1q_u32((const uint32_t *)(data + 16)));
+		acc2 = vpadalq_u32(acc2, vld1q_u32((const uint32_t *)(data + 32)));
+		acc3 = vpadalq_u32(acc3, vld1q_u32((const uint32_t *)(data + 48)));
+	}
+
+	for (; n >= 16; n -= 16, data += 16) {
+		acc0 = vpadalq_u32(acc0, vld1q_u32((const uint32_t *)data));
+	}
+
+	acc0 = vaddq_u64(vaddq_u64(acc0, acc1), vaddq_u64(acc2, acc3));
+	*sum += vaddvq_u64(acc0);
+
+	return len - n;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* x86 internet checksum hook.
+ *
+ * Every 16 byte block is split into four 32-bit words, which are zero
+ * extended and added to two 64-bit lanes, so no carry is lost. SSE2 is
+ * part of x86_64, but it makes the calling thread an FP/SSE user, which
+ * matters with lazy FPU switching, see CONFIG_NET_CHKSUM_X86_SSE2.
+ */
+
+#include <zephyr/sys/util.h>
+#include <immintrin.h>
+
+#include "net_private.h"
+
+#define CHKSUM_SSE2 __attribute__((target("sse2")))
+
+CHKSUM_SSE2 static inline __m128i chksum_add(__m128i acc, __m128i v,
+					     __m128i zero)
+{
+	acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, zero));
+	return _mm_add_epi64(acc, _mm_unpackhi_epi32(v, zero));
+}
+
+CHKSUM_SSE2 size_t net_chksum_hw(uint64_t *sum, const uint8_t *data, size_t len)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i acc0 = zero;
+	__m128i acc1 = zero;
+	uint64_t lanes[2];
+	size_t n = len;
+
+	/* Below 64 bytes the setup costs more than it saves */
+	if (n < 64) {
+		return 0;
+	}
+
+	for (; n >= 64; n -= 64, data += 64) {
+		acc0 = chksum_add(acc0, _mm_loadu_si128((const __m128i *)data), zero);
+		acc1 = chksum_add(acc1, _mm_loadu_si128((const __m128i *)(data + 16)),
+				  zero);
+		acc0 = chksum_add(acc0, _mm_loadu_si128((const __m128i *)(data + 32)),
+				  zero);
+		acc1 = chksum_add(acc1, _mm_loadu_si128((const __m128i *)(data + 48)),
+				  zero);
+	}
+
+	for (; n >= 16; n -= 16, data += 16) {
+		acc0 = chksum_add(acc0, _mm_loadu_si128((const __m128i *)data), zero);
+	}
+
+	_mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(acc0, acc1));
+	*sum += lanes[0] + lanes[1];
+
+	return len - n;
+}
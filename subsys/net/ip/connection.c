@@ -63,6 +63,70 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
+static sys_slist_t conn_retired;
+
+/* Besides conn_used, every registered handler is on exactly one lookup
+ * list so that net_conn_input() only needs to look at the handlers that
+ * can match a packet:
+ *
+ * - UDP/TCP handlers with a local port and a remote address and port,
+ *   hashed on protocol, both ports and remote address,
+ * - other UDP/TCP handlers with a local port, hashed on protocol and
+ *   local port,
+ * - everything else on a single wildcard list.
+ *
+ * The lists are changed under conn_lock but read without it.  Handlers
+ * are inserted at the head, and an unlinked handler keeps its link, so a
+ * reader always sees a consistent list.  An unlinked handler is only
+ * reused once every reader that might still see it is done.  Each reader
+ * is on conn_readers with the generation it started in, and the handler
+ * being called if any, so that net_conn_unregister() can also wait for
+ * the callback to be done with its user_data.
+ */
+#define CONN_HASH_MASK (CONFIG_NET_CONN_HASH_SIZE - 1)
+
+BUILD_ASSERT((CONFIG_NET_CONN_HASH_SIZE & CONN_HASH_MASK) == 0,
+	     "CONFIG_NET_CONN_HASH_SIZE must be a power of two");
+
+static atomic_ptr_t conn_connected[CONFIG_NET_CONN_HASH_SIZE];
+static atomic_ptr_t conn_bound[CONFIG_NET_CONN_HASH_SIZE];
+static atomic_ptr_t conn_wildcard;
+
+/* Number of handlers in conn_connected and conn_bound */
+static atomic_t conn_hashed;
+
+static uint32_t conn_seq;
+
+struct conn_reader {
+	sys_snode_t node;
+
+	/* Thread delivering the packet */
+	k_tid_t thread;
+
+	/* Value of conn_gen when the lookup started */
+	uint32_t gen;
+
+	/* Handler whose callback is being called, if any */
+	struct net_conn *dispatch;
+
+	/* Next candidate of each lookup list, see conn_lookup_next() */
+	struct net_conn **heads;
+	int lists;
+};
+
+/* Protects conn_readers, conn_gen and NET_CONN_IN_USE of registered
+ * handlers.
+ */
+static struct k_spinlock conn_reader_lock;
+static sys_slist_t conn_readers;
+static uint32_t conn_gen;
+
+/* Threads in net_conn_unregister() waiting for readers to move on.  Each
+ * one takes conn_waiters_sem once, and is given it by the next reader
+ * that finishes or calls another handler.
+ */
+static uint32_t conn_waiters;
+static K_SEM_DEFINE(conn_waiters_sem, 0, K_SEM_MAX_LIMIT);
 
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
@@ -116,12 +180,298 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#define CONN_HASH_INIT 2166136261U
+
+static uint32_t conn_hash_word(uint32_t hash, uint32_t val)
+{
+	return (hash ^ val) * 16777619U;
+}
+
+static uint32_t conn_hash_addr(uint32_t hash, const uint8_t *addr, size_t len)
+{
+	for (size_t i = 0; i < len; i += sizeof(uint32_t)) {
+		hash = conn_hash_word(hash, UNALIGNED_GET((uint32_t *)&addr[i]));
+	}
+
+	return hash;
+}
+
+static atomic_ptr_t *conn_bucket(atomic_ptr_t *table, uint32_t hash)
+{
+	return &table[(hash ^ (hash >> 16)) & CONN_HASH_MASK];
+}
+
+/* Ports are in network byte order, as found in the packet */
+static uint32_t conn_hash_local(uint16_t proto, uint16_t local_port)
+{
+	return conn_hash_word(CONN_HASH_INIT,
+			      ((uint32_t)proto << 16) | local_port);
+}
+
+static uint32_t conn_hash_remote(uint32_t hash, uint8_t family,
+				 const uint8_t *remote_addr,
+				 uint16_t remote_port)
+{
+	hash = conn_hash_word(hash, remote_port);
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		hash = conn_hash_addr(hash, remote_addr, sizeof(struct in6_addr));
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+		hash = conn_hash_addr(hash, remote_addr, sizeof(struct in_addr));
+	}
+
+	return hash;
+}
+
+static bool conn_is_hashed(struct net_conn *conn)
+{
+	if (!(conn->flags & NET_CONN_LOCAL_PORT_SPEC)) {
+		return false;
+	}
+
+	if (!(IS_ENABLED(CONFIG_NET_UDP) && conn->proto == IPPROTO_UDP) &&
+	    !(IS_ENABLED(CONFIG_NET_TCP) && conn->proto == IPPROTO_TCP)) {
+		return false;
+	}
+
+	return (IS_ENABLED(CONFIG_NET_IPV4) && conn->family == AF_INET) ||
+	       (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6);
+}
+
+static atomic_ptr_t *conn_lookup_list(struct net_conn *conn)
+{
+	uint8_t connected = NET_CONN_REMOTE_ADDR_SPEC | NET_CONN_REMOTE_PORT_SPEC;
+	struct sockaddr *remote = &conn->remote_addr;
+	uint32_t hash;
+
+	if (!conn_is_hashed(conn)) {
+		return &conn_wildcard;
+	}
+
+	hash = conn_hash_local(conn->proto,
+			       net_sin(&conn->local_addr)->sin_port);
+
+	if ((conn->flags & connected) != connected) {
+		return conn_bucket(conn_bound, hash);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && remote->sa_family == AF_INET6) {
+		hash = conn_hash_remote(hash, AF_INET6,
+					net_sin6(remote)->sin6_addr.s6_addr,
+					net_sin6(remote)->sin6_port);
+	} else {
+		hash = conn_hash_remote(hash, remote->sa_family,
+					(uint8_t *)&net_sin(remote)->sin_addr,
+					net_sin(remote)->sin_port);
+	}
+
+	return conn_bucket(conn_connected, hash);
+}
+
+/* must be called with conn_lock held */
+static void conn_lookup_add(struct net_conn *conn)
+{
+	atomic_ptr_t *list = conn_lookup_list(conn);
+
+	conn->seq = ++conn_seq;
+	atomic_ptr_set(&conn->lookup_next, atomic_ptr_get(list));
+	atomic_ptr_set(list, conn);
+
+	if (list != &conn_wildcard) {
+		atomic_inc(&conn_hashed);
+	}
+}
+
+/* must be called with conn_lock held */
+static void conn_lookup_remove(struct net_conn *conn)
+{
+	atomic_ptr_t *list = conn_lookup_list(conn);
+	atomic_ptr_t *link = list;
+	struct net_conn *cur;
+
+	while ((cur = atomic_ptr_get(link)) != NULL) {
+		if (cur == conn) {
+			/* conn->lookup_next stays valid for current readers */
+			atomic_ptr_set(link, atomic_ptr_get(&conn->lookup_next));
+			break;
+		}
+
+		link = &cur->lookup_next;
+	}
+
+	if (list != &conn_wildcard) {
+		atomic_dec(&conn_hashed);
+	}
+}
+
+static void conn_read_lock(struct conn_reader *reader)
+{
+	reader->thread = k_current_get();
+	reader->dispatch = NULL;
+	reader->heads = NULL;
+	reader->lists = 0;
+
+	K_SPINLOCK(&conn_reader_lock) {
+		reader->gen = conn_gen;
+		sys_slist_prepend(&conn_readers, &reader->node);
+	}
+}
+
+/* Must be called with conn_reader_lock held, and the result passed to
+ * conn_wake_waiters() once it is released.
+ */
+static uint32_t conn_take_waiters_locked(void)
+{
+	uint32_t waiters = conn_waiters;
+
+	conn_waiters = 0U;
+
+	return waiters;
+}
+
+static void conn_wake_waiters(uint32_t waiters)
+{
+	while (waiters-- > 0U) {
+		k_sem_give(&conn_waiters_sem);
+	}
+}
+
+static void conn_read_unlock(struct conn_reader *reader)
+{
+	uint32_t waiters;
+
+	K_SPINLOCK(&conn_reader_lock) {
+		sys_slist_find_and_remove(&conn_readers, &reader->node);
+		waiters = conn_take_waiters_locked();
+	}
+
+	conn_wake_waiters(waiters);
+}
+
+/* Check that an unregistered handler is still in use before calling its
+ * callback, and tell net_conn_unregister() that it is being called.
+ */
+static bool conn_dispatch_begin(struct conn_reader *reader,
+				struct net_conn *conn)
+{
+	uint32_t waiters = 0U;
+	bool in_use = false;
+
+	K_SPINLOCK(&conn_reader_lock) {
+		if (conn->flags & NET_CONN_IN_USE) {
+			reader->dispatch = conn;
+			waiters = conn_take_waiters_locked();
+			in_use = true;
+		}
+	}
+
+	conn_wake_waiters(waiters);
+
+	return in_use;
+}
+
+static void conn_dispatch_end(struct conn_reader *reader)
+{
+	K_SPINLOCK(&conn_reader_lock) {
+		reader->dispatch = NULL;
+	}
+}
+
+/* Whether the reader started before conn was unregistered */
+static bool conn_reader_is_older(struct conn_reader *reader,
+				 struct net_conn *conn)
+{
+	return (int32_t)(reader->gen - conn->retired_gen) <= 0;
+}
+
+/* Whether the current thread is delivering a packet, i.e. called from a
+ * connection callback.  Must be called with conn_reader_lock held.
+ */
+static bool conn_is_reader_locked(void)
+{
+	struct conn_reader *reader;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_readers, reader, node) {
+		if (reader->thread == k_current_get()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Whether a reader might still look at an unregistered handler.  Readers
+ * of the current thread are suspended in a callback, so only the handlers
+ * they are about to look at next, or calling, matter.  Must be called with
+ * conn_reader_lock held.
+ */
+static bool conn_is_pinned(struct net_conn *conn)
+{
+	struct conn_reader *reader;
+	struct net_conn *next;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_readers, reader, node) {
+		if (!conn_reader_is_older(reader, conn)) {
+			continue;
+		}
+
+		if (reader->thread != k_current_get() ||
+		    reader->dispatch == conn) {
+			return true;
+		}
+
+		for (int i = 0; i < reader->lists; i++) {
+			for (next = reader->heads[i];
+			     next != NULL && !(next->flags & NET_CONN_IN_USE);
+			     next = atomic_ptr_get(&next->lookup_next)) {
+				if (next == conn) {
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+/* Move unregistered handlers no reader can see anymore back to the unused
+ * list.  Must be called with conn_lock held.
+ */
+static void conn_reclaim(void)
+{
+	struct net_conn *conn;
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node;
+	sys_snode_t *next;
+
+	K_SPINLOCK(&conn_reader_lock) {
+		SYS_SLIST_FOR_EACH_NODE_SAFE(&conn_retired, node, next) {
+			conn = CONTAINER_OF(node, struct net_conn, node);
+
+			if (conn_is_pinned(conn)) {
+				prev = node;
+				continue;
+			}
+
+			sys_slist_remove(&conn_retired, prev, node);
+			(void)memset(conn, 0, sizeof(*conn));
+			sys_slist_prepend(&conn_unused, &conn->node);
+		}
+	}
+}
+
+/* Never waits: callers may hold a lock that a callback of a packet
+ * pinning an unregistered handler is blocked on.  If only such handlers
+ * are left, registering fails.
+ */
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+	conn_reclaim();
+
 	node = sys_slist_peek_head(&conn_unused);
 	if (!node) {
 		k_mutex_unlock(&conn_lock);
@@ -141,6 +491,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_lookup_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -381,9 +732,48 @@ error:
 	return -EINVAL;
 }
 
-int net_conn_unregister(struct net_conn_handle *handle)
+/* Whether a packet being delivered by another thread may still call the
+ * callback of a handler unregistered in generation gen.  The ones calling
+ * another handler re-check NET_CONN_IN_USE before calling this one.
+ * Must be called with conn_reader_lock held.
+ */
+static bool conn_is_busy_locked(struct net_conn *conn, uint32_t gen)
+{
+	struct conn_reader *reader;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_readers, reader, node) {
+		if ((int32_t)(reader->gen - gen) <= 0 &&
+		    (reader->dispatch == NULL || reader->dispatch == conn)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Sleep until no packet being delivered may call the handler's callback */
+static void conn_wait_idle(struct net_conn *conn, uint32_t gen)
+{
+	bool busy = true;
+
+	while (busy) {
+		K_SPINLOCK(&conn_reader_lock) {
+			busy = conn_is_busy_locked(conn, gen);
+			if (busy) {
+				conn_waiters++;
+			}
+		}
+
+		if (busy) {
+			(void)k_sem_take(&conn_waiters_sem, K_FOREVER);
+		}
+	}
+}
+
+static int conn_unregister(struct net_conn_handle *handle, bool wait)
 {
 	struct net_conn *conn = (struct net_conn *)handle;
+	uint32_t gen;
 
 	if (conn < &conns[0] || conn > &conns[CONFIG_NET_MAX_CONN]) {
 		return -EINVAL;
@@ -397,13 +787,43 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_lookup_remove(conn);
+
+	/* net_conn_input() may still be looking at it, see conn_reclaim() */
+	K_SPINLOCK(&conn_reader_lock) {
+		conn->flags &= ~NET_CONN_IN_USE;
+		conn->retired_gen = conn_gen++;
+		gen = conn->retired_gen;
+
+		/* Called from a callback, the threads delivering to this
+		 * one might be waiting for us.
+		 */
+		if (conn_is_reader_locked()) {
+			wait = false;
+		}
+	}
+
+	sys_slist_append(&conn_retired, &conn->node);
+	conn_reclaim();
 	k_mutex_unlock(&conn_lock);
 
-	conn_set_unused(conn);
+	if (wait) {
+		conn_wait_idle(conn, gen);
+	}
 
 	return 0;
 }
 
+int net_conn_unregister(struct net_conn_handle *handle)
+{
+	return conn_unregister(handle, true);
+}
+
+int net_conn_unregister_nowait(struct net_conn_handle *handle)
+{
+	return conn_unregister(handle, false);
+}
+
 int net_conn_change_callback(struct net_conn_handle *handle,
 			     net_conn_cb_t cb, void *user_data)
 {
@@ -521,9 +941,12 @@ static bool conn_are_endpoints_valid(struct net_pkt *pkt, uint8_t family,
 	return !are_invalid_endpoints;
 }
 
-static enum net_verdict conn_raw_socket(struct net_pkt *pkt,
+static enum net_verdict conn_raw_socket(struct conn_reader *reader,
+					struct net_pkt *pkt,
 					struct net_conn *conn, uint8_t proto)
 {
+	enum net_verdict verdict;
+
 	if (proto == ETH_P_ALL) {
 		enum net_sock_type type = net_context_get_type(conn->context);
 
@@ -550,14 +973,22 @@ static enum net_verdict conn_raw_socket(struct net_pkt *pkt,
 	NET_DBG("[%p] raw match found cb %p ud %p", conn, conn->cb,
 		conn->user_data);
 
+	if (!conn_dispatch_begin(reader, conn)) {
+		return NET_CONTINUE;
+	}
+
 	raw_pkt = net_pkt_clone(pkt, CLONE_TIMEOUT);
 	if (!raw_pkt) {
+		conn_dispatch_end(reader);
 		net_stats_update_per_proto_drop(pkt_iface, proto);
 		NET_WARN("pkt cloning failed, pkt %p dropped", pkt);
 		return NET_DROP;
 	}
 
-	if (conn->cb(conn, raw_pkt, NULL, NULL, conn->user_data) == NET_DROP) {
+	verdict = conn->cb(conn, raw_pkt, NULL, NULL, conn->user_data);
+	conn_dispatch_end(reader);
+
+	if (verdict == NET_DROP) {
 		net_stats_update_per_proto_drop(pkt_iface, proto);
 		net_pkt_unref(raw_pkt);
 	} else {
@@ -567,10 +998,60 @@ static enum net_verdict conn_raw_socket(struct net_pkt *pkt,
 	return NET_OK;
 }
 
-enum net_verdict net_conn_input(struct net_pkt *pkt,
-				union net_ip_header *ip_hdr,
-				uint8_t proto,
-				union net_proto_header *proto_hdr)
+/* Next candidate handler, newest first as if all lists were one */
+static struct net_conn *conn_lookup_next(struct net_conn **heads, int count)
+{
+	struct net_conn *conn = NULL;
+	int found = 0;
+
+	for (int i = 0; i < count; i++) {
+		if (heads[i] != NULL &&
+		    (conn == NULL || (int32_t)(heads[i]->seq - conn->seq) > 0)) {
+			conn = heads[i];
+			found = i;
+		}
+	}
+
+	if (conn != NULL) {
+		heads[found] = atomic_ptr_get(&conn->lookup_next);
+	}
+
+	return conn;
+}
+
+/* Whether a UDP/TCP handler would have a packet socket packet received on
+ * iface handed back to the IP stack.
+ */
+static bool conn_hashed_wants_iface(struct net_if *iface)
+{
+	atomic_ptr_t *tables[] = { conn_connected, conn_bound };
+	struct net_conn *conn;
+
+	if (atomic_get(&conn_hashed) == 0) {
+		return false;
+	}
+
+	for (int t = 0; t < ARRAY_SIZE(tables); t++) {
+		for (int i = 0; i < CONFIG_NET_CONN_HASH_SIZE; i++) {
+			for (conn = atomic_ptr_get(&tables[t][i]); conn != NULL;
+			     conn = atomic_ptr_get(&conn->lookup_next)) {
+				if (conn->context == NULL ||
+				    !net_context_is_bound_to_iface(conn->context) ||
+				    iface == net_context_get_iface(conn->context)) {
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+static enum net_verdict conn_input(struct conn_reader *reader,
+				   struct net_pkt *pkt,
+				   union net_ip_header *ip_hdr,
+				   uint8_t proto,
+				   union net_proto_header *proto_hdr)
 {
 	struct net_if *pkt_iface = net_pkt_iface(pkt);
 	uint8_t pkt_family = net_pkt_family(pkt);
@@ -622,6 +1103,29 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 	bool raw_pkt_delivered = false;
 	bool raw_pkt_continue = false;
 	struct net_conn *conn;
+	struct net_conn *heads[3] = { atomic_ptr_get(&conn_wildcard) };
+	int lists = 1;
+
+	if (IS_ENABLED(CONFIG_NET_IP) && (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    ((IS_ENABLED(CONFIG_NET_UDP) && proto == IPPROTO_UDP) ||
+	     (IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP))) {
+		uint32_t hash = conn_hash_local(proto, dst_port);
+		uint8_t *src = (pkt_family == AF_INET6) ? ip_hdr->ipv6->src :
+							   ip_hdr->ipv4->src;
+
+		heads[lists++] = atomic_ptr_get(conn_bucket(conn_bound, hash));
+
+		hash = conn_hash_remote(hash, pkt_family, src, src_port);
+		heads[lists++] = atomic_ptr_get(conn_bucket(conn_connected, hash));
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && pkt_family == AF_PACKET) {
+		/* Hashed handlers are all IPv4 or IPv6 ones, the loop below
+		 * would only note that they exist.
+		 */
+		raw_pkt_continue = conn_hashed_wants_iface(pkt_iface);
+	}
+
+	reader->heads = heads;
+	reader->lists = lists;
 
 	if (IS_ENABLED(CONFIG_NET_IP)) {
 		/* If we receive a packet with multicast destination address, we might
@@ -639,7 +1143,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	while ((conn = conn_lookup_next(heads, lists)) != NULL) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
 		    net_context_is_bound_to_iface(conn->context) &&
@@ -700,7 +1204,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 			/* With IPPROTO_RAW deliver only if protocol match: */
 			if ((proto == ETH_P_ALL && conn->proto != IPPROTO_RAW) ||
 			    conn->proto == proto) {
-				enum net_verdict ret = conn_raw_socket(pkt, conn, proto);
+				enum net_verdict ret = conn_raw_socket(reader, pkt, conn,
+								       proto);
 
 				if (ret == NET_DROP) {
 					goto drop;
@@ -745,6 +1250,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 			}
 
 			if (best_rank < NET_CONN_RANK(conn->flags)) {
+				enum net_verdict verdict;
 				struct net_pkt *mcast_pkt;
 
 				if (!is_mcast_pkt) {
@@ -764,13 +1270,21 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
 					conn->user_data);
 
+				if (!conn_dispatch_begin(reader, conn)) {
+					continue; /* unregistered meanwhile */
+				}
+
 				mcast_pkt = net_pkt_clone(pkt, CLONE_TIMEOUT);
 				if (!mcast_pkt) {
+					conn_dispatch_end(reader);
 					goto drop;
 				}
 
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
+				verdict = conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr,
+						   conn->user_data);
+				conn_dispatch_end(reader);
+
+				if (verdict == NET_DROP) {
 					net_stats_update_per_proto_drop(pkt_iface, proto);
 					net_pkt_unref(mcast_pkt);
 				} else {
@@ -811,12 +1325,20 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		return NET_OK;
 	}
 
-	if (best_match) {
+	/* The handler may have been unregistered since the lookup, its
+	 * user_data is not to be used then.
+	 */
+	if (best_match && conn_dispatch_begin(reader, best_match)) {
+		enum net_verdict verdict;
+
 		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x", best_match, best_match->cb,
 			best_match->user_data, best_match->flags);
 
-		if (best_match->cb(best_match, pkt, ip_hdr, proto_hdr, best_match->user_data)
-				== NET_DROP) {
+		verdict = best_match->cb(best_match, pkt, ip_hdr, proto_hdr,
+					 best_match->user_data);
+		conn_dispatch_end(reader);
+
+		if (verdict == NET_DROP) {
 			goto drop;
 		}
 
@@ -842,6 +1364,21 @@ drop:
 	return NET_DROP;
 }
 
+enum net_verdict net_conn_input(struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				uint8_t proto,
+				union net_proto_header *proto_hdr)
+{
+	struct conn_reader reader;
+	enum net_verdict verdict;
+
+	conn_read_lock(&reader);
+	verdict = conn_input(&reader, pkt, ip_hdr, proto, proto_hdr);
+	conn_read_unlock(&reader);
+
+	return verdict;
+}
+
 void net_conn_foreach(net_conn_foreach_cb_t cb, void *user_data)
 {
 	struct net_conn *conn;
@@ -861,6 +1398,8 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+	sys_slist_init(&conn_retired);
+	sys_slist_init(&conn_readers);
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
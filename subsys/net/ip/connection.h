@@ -15,6 +15,7 @@
 
 #include <zephyr/types.h>
 
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/util.h>
 
 #include <zephyr/net/net_context.h>
@@ -54,6 +55,15 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+	/** Next connection in the same lookup list, read without locking */
+	atomic_ptr_t lookup_next;
+
+	/** Registration sequence number, lookups try newer ones first */
+	uint32_t seq;
+
+	/** Lookup generation when unregistered, see net_conn_unregister() */
+	uint32_t retired_gen;
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
@@ -97,7 +107,12 @@ struct net_conn {
  * @param user_data User data supplied by caller.
  * @param handle Connection handle that can be used when unregistering
  *
- * @return Return 0 if the registration succeed, <0 otherwise.
+ * Never waits.  An unregistered handler is only reused once no packet
+ * being delivered can see it anymore, so until then it does not count as
+ * free.
+ *
+ * @return Return 0 if the registration succeed, -ENOENT if no handler is
+ * free, <0 otherwise.
  */
 #if defined(CONFIG_NET_NATIVE)
 int net_conn_register(uint16_t proto, uint8_t family,
@@ -138,6 +153,13 @@ static inline int net_conn_register(uint16_t proto, uint8_t family,
 /**
  * @brief Unregister connection handler.
  *
+ * Once this returns, the callback is not called anymore and is not running
+ * in another thread, so its user_data can be released.  This is not the
+ * case when called from a connection callback, which must not wait for
+ * packets being delivered by other threads.
+ *
+ * The caller must not hold a lock the callback may take.
+ *
  * @param handle Handle from registering.
  *
  * @return Return 0 if the unregistration succeed, <0 otherwise.
@@ -153,6 +175,27 @@ static inline int net_conn_unregister(struct net_conn_handle *handle)
 }
 #endif
 
+/**
+ * @brief Unregister connection handler without waiting for its callback.
+ *
+ * For replacing a handler by one with the same user_data, which stays
+ * valid, while holding a lock the callback may take.
+ *
+ * @param handle Handle from registering.
+ *
+ * @return Return 0 if the unregistration succeed, <0 otherwise.
+ */
+#if defined(CONFIG_NET_NATIVE)
+int net_conn_unregister_nowait(struct net_conn_handle *handle);
+#else
+static inline int net_conn_unregister_nowait(struct net_conn_handle *handle)
+{
+	ARG_UNUSED(handle);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Change the callback and user_data for a registered connection
  * handle.
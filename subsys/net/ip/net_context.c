@@ -359,17 +359,19 @@ int net_context_unref(struct net_context *context)
 		return old_rc - 1;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	/* Not holding the lock, as packets being delivered to the context
+	 * take it and net_conn_unregister() waits for them.
+	 */
+	if (context->conn_handler &&
+	    (IS_ENABLED(CONFIG_NET_TCP) || IS_ENABLED(CONFIG_NET_UDP) ||
+	     IS_ENABLED(CONFIG_NET_SOCKETS_CAN) ||
+	     IS_ENABLED(CONFIG_NET_SOCKETS_PACKET))) {
+		net_conn_unregister(context->conn_handler);
+	}
 
-	if (context->conn_handler) {
-		if (IS_ENABLED(CONFIG_NET_TCP) || IS_ENABLED(CONFIG_NET_UDP) ||
-		    IS_ENABLED(CONFIG_NET_SOCKETS_CAN) ||
-		    IS_ENABLED(CONFIG_NET_SOCKETS_PACKET)) {
-			net_conn_unregister(context->conn_handler);
-		}
+	k_mutex_lock(&context->lock, K_FOREVER);
 
-		context->conn_handler = NULL;
-	}
+	context->conn_handler = NULL;
 
 	net_context_set_state(context, NET_CONTEXT_UNCONNECTED);
 
@@ -405,12 +407,19 @@ int net_context_put(struct net_context *context)
 	context->recv_cb = NULL;
 	context->send_cb = NULL;
 
+	/* The connection handlers are unregistered below, which waits for
+	 * the packets being delivered to the context, so drop the lock.
+	 */
+	k_mutex_unlock(&context->lock);
+
 	/* net_tcp_put() will handle decrementing refcount on stack's behalf */
 	net_tcp_put(context);
 
 	/* Decrement refcount on user app's behalf */
 	net_context_unref(context);
 
+	return ret;
+
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -1977,8 +1986,9 @@ static int recv_udp(struct net_context *context,
 
 	ARG_UNUSED(timeout);
 
+	/* Replaced below with the same user_data, and the lock is held */
 	if (context->conn_handler) {
-		net_conn_unregister(context->conn_handler);
+		net_conn_unregister_nowait(context->conn_handler);
 		context->conn_handler = NULL;
 	}
 
@@ -2075,8 +2085,9 @@ static int recv_raw(struct net_context *context,
 
 	context->recv_cb = cb;
 
+	/* Replaced below with the same user_data, and the lock is held */
 	if (context->conn_handler) {
-		net_conn_unregister(context->conn_handler);
+		net_conn_unregister_nowait(context->conn_handler);
 		context->conn_handler = NULL;
 	}
 
@@ -2308,11 +2319,18 @@ static int set_context_rcvbuf(struct net_context *context,
 		return -EINVAL;
 	}
 
-	if ((rcvbuf_value < 0) || (rcvbuf_value > UINT16_MAX)) {
+	if (rcvbuf_value < 0) {
 		return -EINVAL;
 	}
 
-	context->options.rcvbuf = (uint16_t) rcvbuf_value;
+	/* Windows past 64 KiB can only be advertised with window scaling */
+	if (IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE)) {
+		rcvbuf_value = MIN(rcvbuf_value, NET_TCP_MAX_WINDOW);
+	} else if (rcvbuf_value > UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	context->options.rcvbuf = rcvbuf_value;
 
 	return 0;
 #else
@@ -2330,11 +2348,18 @@ static int set_context_sndbuf(struct net_context *context,
 		return -EINVAL;
 	}
 
-	if ((sndbuf_value < 0) || (sndbuf_value > UINT16_MAX)) {
+	if (sndbuf_value < 0) {
+		return -EINVAL;
+	}
+
+	/* Windows past 64 KiB can only be advertised with window scaling */
+	if (IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE)) {
+		sndbuf_value = MIN(sndbuf_value, NET_TCP_MAX_WINDOW);
+	} else if (sndbuf_value > UINT16_MAX) {
 		return -EINVAL;
 	}
 
-	context->options.sndbuf = (uint16_t) sndbuf_value;
+	context->options.sndbuf = sndbuf_value;
 	return 0;
 #else
 	return -ENOTSUP;
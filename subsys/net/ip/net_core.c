@@ -58,6 +58,398 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 
 #include "net_stats.h"
 
+#if defined(CONFIG_NET_GRO)
+/* Generic receive offload. Consecutive TCP segments of a flow that are
+ * waiting in the RX queue are merged into the first one, which then goes
+ * through IP and TCP input only once. A held packet is passed up when a
+ * segment cannot be merged into it, or when the RX queue has been drained.
+ */
+struct gro_flow {
+	struct net_pkt *pkt;	/* Packet the segments are merged into */
+	uint32_t stamp;		/* When the flow was started, oldest goes first */
+	uint32_t next_seq;	/* Sequence number expected next */
+	uint16_t len;		/* Length of the packet, headers included */
+	uint16_t hdr_len;	/* IP and TCP header length */
+	uint16_t mss;		/* Payload length of the first segment */
+	uint16_t segs;		/* Number of segments in the packet */
+	uint8_t flags;		/* TCP flags of the merged segments */
+};
+
+static struct gro_flow gro_flows[CONFIG_NET_GRO_MAX_FLOWS];
+static uint32_t gro_stamp;
+static K_MUTEX_DEFINE(gro_lock);
+
+/* TCP segment headers, as seen when coalescing */
+struct gro_hdr {
+	uint8_t *ip;
+	struct tcphdr *th;
+	uint16_t hdr_len;
+	uint16_t len;
+};
+
+/* What to do with a received packet */
+enum gro_action {
+	GRO_SKIP,	/* Not TCP, nothing held can be affected */
+	GRO_FLUSH_ALL,	/* Maybe TCP, of a flow that cannot be told */
+	GRO_FLUSH,	/* TCP segment that is not merged, see hdr */
+	GRO_MERGE,	/* Data segment that can be merged, see hdr */
+};
+
+/* Only plain IPv4/IPv6 TCP segments carrying data, whose headers all sit
+ * in the first buffer, are coalesced. Any other segment of a flow must
+ * not overtake the data held for it.
+ */
+static enum gro_action gro_parse(struct net_pkt *pkt, struct gro_hdr *hdr)
+{
+	struct net_buf *buf = pkt->buffer;
+	size_t pkt_len = net_pkt_get_len(pkt);
+	uint8_t ip_len;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)buf->data;
+
+		ip_len = sizeof(struct net_ipv4_hdr);
+
+		if (buf->len < ip_len) {
+			return GRO_FLUSH_ALL;
+		}
+
+		if (ipv4_hdr->proto != IPPROTO_TCP) {
+			return GRO_SKIP;
+		}
+
+		if (buf->len < ip_len + sizeof(struct tcphdr) ||
+		    ipv4_hdr->vhl != 0x45 ||
+		    ntohs(ipv4_hdr->len) != pkt_len ||
+		    (sys_get_be16(ipv4_hdr->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK))) {
+			return GRO_FLUSH_ALL;
+		}
+
+		net_pkt_set_ipv4_opts_len(pkt, 0);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		struct net_ipv6_hdr *ipv6_hdr = (struct net_ipv6_hdr *)buf->data;
+
+		ip_len = sizeof(struct net_ipv6_hdr);
+
+		if (buf->len < ip_len) {
+			return GRO_FLUSH_ALL;
+		}
+
+		if (ipv6_hdr->nexthdr == IPPROTO_UDP ||
+		    ipv6_hdr->nexthdr == IPPROTO_ICMPV6) {
+			return GRO_SKIP;
+		}
+
+		/* Extension headers may lead to TCP */
+		if (buf->len < ip_len + sizeof(struct tcphdr) ||
+		    ipv6_hdr->nexthdr != IPPROTO_TCP ||
+		    ntohs(ipv6_hdr->len) + ip_len != pkt_len) {
+			return GRO_FLUSH_ALL;
+		}
+
+		net_pkt_set_ipv6_ext_len(pkt, 0);
+	} else {
+		return GRO_SKIP;
+	}
+
+	hdr->ip = buf->data;
+	hdr->th = (struct tcphdr *)(buf->data + ip_len);
+	hdr->hdr_len = ip_len + th_off(hdr->th) * 4U;
+	hdr->len = pkt_len;
+
+	/* Needed by the checksum calculation */
+	net_pkt_set_ip_hdr_len(pkt, ip_len);
+
+	if (th_off(hdr->th) < 5U || buf->len < hdr->hdr_len ||
+	    hdr->len <= hdr->hdr_len ||
+	    (hdr->th->th_flags & ~PSH) != ACK) {
+		return GRO_FLUSH;
+	}
+
+	return GRO_MERGE;
+}
+
+/* Same connection: addresses, ports and interface */
+static bool gro_same_flow(struct gro_flow *flow, struct net_pkt *pkt,
+			  struct gro_hdr *hdr)
+{
+	uint8_t *ip = flow->pkt->buffer->data;
+	struct tcphdr *th = (struct tcphdr *)(ip + net_pkt_ip_hdr_len(flow->pkt));
+
+	if (net_pkt_iface(flow->pkt) != net_pkt_iface(pkt) ||
+	    net_pkt_family(flow->pkt) != net_pkt_family(pkt) ||
+	    memcmp(&th->th_sport, &hdr->th->th_sport, 2 * sizeof(uint16_t))) {
+		return false;
+	}
+
+	if (net_pkt_family(pkt) == AF_INET) {
+		return !memcmp(ip + offsetof(struct net_ipv4_hdr, src),
+			       hdr->ip + offsetof(struct net_ipv4_hdr, src),
+			       2 * NET_IPV4_ADDR_SIZE);
+	}
+
+	return !memcmp(ip + offsetof(struct net_ipv6_hdr, src),
+		       hdr->ip + offsetof(struct net_ipv6_hdr, src),
+		       2 * NET_IPV6_ADDR_SIZE);
+}
+
+/* The segment continues the packet and carries the same header fields */
+static bool gro_can_merge(struct gro_flow *flow, struct gro_hdr *hdr)
+{
+	uint8_t *ip = flow->pkt->buffer->data;
+	struct tcphdr *th = (struct tcphdr *)(ip + net_pkt_ip_hdr_len(flow->pkt));
+	uint16_t data_len = hdr->len - hdr->hdr_len;
+
+	if (th_seq(hdr->th) != flow->next_seq ||
+	    hdr->hdr_len != flow->hdr_len ||
+	    data_len > flow->mss ||
+	    flow->len + data_len > CONFIG_NET_GRO_MAX_SIZE) {
+		return false;
+	}
+
+	/* The ECN bits must not get lost */
+	if (net_pkt_family(flow->pkt) == AF_INET) {
+		if (((struct net_ipv4_hdr *)ip)->tos !=
+		    ((struct net_ipv4_hdr *)hdr->ip)->tos) {
+			return false;
+		}
+	} else if (memcmp(ip, hdr->ip, offsetof(struct net_ipv6_hdr, len))) {
+		return false;
+	}
+
+	/* Acknowledgment, window and options */
+	return th->th_ack == hdr->th->th_ack && th->th_win == hdr->th->th_win &&
+	       !memcmp(th + 1, hdr->th + 1, hdr->hdr_len - net_pkt_ip_hdr_len(flow->pkt) -
+		       sizeof(struct tcphdr));
+}
+
+static bool gro_chksum_ok(struct net_pkt *pkt)
+{
+	if (!net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+		return true;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET &&
+	    net_calc_chksum_ipv4(pkt) != 0U) {
+		return false;
+	}
+
+	return !IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) || net_calc_chksum_tcp(pkt) == 0U;
+}
+
+static void gro_start(struct gro_flow *flow, struct net_pkt *pkt,
+		      struct gro_hdr *hdr)
+{
+	flow->pkt = pkt;
+	flow->stamp = gro_stamp++;
+	flow->next_seq = th_seq(hdr->th) + hdr->len - hdr->hdr_len;
+	flow->len = hdr->len;
+	flow->hdr_len = hdr->hdr_len;
+	flow->mss = hdr->len - hdr->hdr_len;
+	flow->segs = 1U;
+	flow->flags = hdr->th->th_flags;
+}
+
+static void gro_merge(struct gro_flow *flow, struct net_pkt *pkt,
+		      struct gro_hdr *hdr)
+{
+	uint16_t data_len = hdr->len - hdr->hdr_len;
+	uint8_t flags = hdr->th->th_flags;
+
+	/* Keep the payload only */
+	if (pkt->buffer->len > hdr->hdr_len) {
+		net_buf_pull(pkt->buffer, hdr->hdr_len);
+	} else {
+		net_pkt_cursor_init(pkt);
+		net_pkt_pull(pkt, hdr->hdr_len);
+	}
+
+	net_pkt_append_buffer(flow->pkt, pkt->buffer);
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	flow->next_seq += data_len;
+	flow->len += data_len;
+	flow->segs++;
+	flow->flags |= flags;
+}
+
+/* Take the packet out of the flow, with its headers describing all the
+ * merged segments.
+ */
+static struct net_pkt *gro_finish(struct gro_flow *flow)
+{
+	struct net_pkt *pkt = flow->pkt;
+	uint8_t *ip = pkt->buffer->data;
+	struct tcphdr *th = (struct tcphdr *)(ip + net_pkt_ip_hdr_len(pkt));
+
+	flow->pkt = NULL;
+
+	if (flow->segs == 1U) {
+		return pkt;
+	}
+
+	th->th_flags = flow->flags;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)ip;
+
+		ipv4_hdr->len = htons(flow->len);
+
+		if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+			ipv4_hdr->chksum = 0U;
+			ipv4_hdr->chksum = net_calc_chksum_ipv4(pkt);
+		}
+	} else {
+		((struct net_ipv6_hdr *)ip)->len =
+			htons(flow->len - sizeof(struct net_ipv6_hdr));
+	}
+
+	/* Tells TCP input the segments were verified already */
+	net_pkt_set_gso_size(pkt, flow->mss);
+
+	net_stats_update_gro(net_pkt_iface(pkt), flow->segs);
+
+	return pkt;
+}
+
+static void gro_deliver(struct net_pkt *pkt)
+{
+	enum net_verdict verdict;
+
+	if (!pkt) {
+		return;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		verdict = net_ipv6_input(pkt, false);
+	} else {
+		verdict = net_ipv4_input(pkt);
+	}
+
+	if (verdict != NET_OK) {
+		NET_DBG("Dropping pkt %p", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+
+/* A free slot, or the flow that was started first */
+static struct gro_flow *gro_flow_alloc(void)
+{
+	struct gro_flow *flow = &gro_flows[0];
+
+	for (int i = 0; i < ARRAY_SIZE(gro_flows); i++) {
+		if (!gro_flows[i].pkt) {
+			return &gro_flows[i];
+		}
+
+		if ((int32_t)(gro_flows[i].stamp - flow->stamp) < 0) {
+			flow = &gro_flows[i];
+		}
+	}
+
+	return flow;
+}
+
+static enum net_verdict gro_receive(struct net_pkt *pkt)
+{
+	struct gro_flow *flow = NULL;
+	struct net_pkt *flushed = NULL;
+	enum net_verdict verdict = NET_OK;
+	struct gro_hdr hdr;
+	enum gro_action action;
+
+	action = gro_parse(pkt, &hdr);
+	if (action == GRO_SKIP) {
+		return NET_CONTINUE;
+	}
+
+	if (action == GRO_FLUSH_ALL) {
+		net_gro_flush();
+		return NET_CONTINUE;
+	}
+
+	k_mutex_lock(&gro_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(gro_flows); i++) {
+		if (gro_flows[i].pkt && gro_same_flow(&gro_flows[i], pkt, &hdr)) {
+			flow = &gro_flows[i];
+			break;
+		}
+	}
+
+	/* Pass up what is held before the segment, e.g. data before a FIN */
+	if (action == GRO_FLUSH) {
+		if (flow) {
+			flushed = gro_finish(flow);
+		}
+
+		verdict = NET_CONTINUE;
+		goto out;
+	}
+
+	if (flow) {
+		/* The held segment is verified only once there is a second
+		 * one to merge, a lone segment is verified by TCP as usual.
+		 */
+		if (gro_can_merge(flow, &hdr) &&
+		    (flow->segs > 1U || gro_chksum_ok(flow->pkt)) &&
+		    gro_chksum_ok(pkt)) {
+			gro_merge(flow, pkt, &hdr);
+
+			/* Pass it up now if nothing more can follow */
+			if ((flow->flags & PSH) ||
+			    hdr.len - hdr.hdr_len < flow->mss ||
+			    flow->len + flow->mss > CONFIG_NET_GRO_MAX_SIZE) {
+				flushed = gro_finish(flow);
+			}
+
+			goto out;
+		}
+
+		flushed = gro_finish(flow);
+	}
+
+	/* Nothing can be merged after a push */
+	if (hdr.th->th_flags & PSH) {
+		verdict = NET_CONTINUE;
+		goto out;
+	}
+
+	if (!flow) {
+		flow = gro_flow_alloc();
+		if (flow->pkt) {
+			flushed = gro_finish(flow);
+		}
+	}
+
+	gro_start(flow, pkt, &hdr);
+
+out:
+	k_mutex_unlock(&gro_lock);
+
+	gro_deliver(flushed);
+
+	return verdict;
+}
+
+void net_gro_flush(void)
+{
+	struct net_pkt *pkt;
+
+	for (int i = 0; i < ARRAY_SIZE(gro_flows); i++) {
+		k_mutex_lock(&gro_lock, K_FOREVER);
+		pkt = gro_flows[i].pkt ? gro_finish(&gro_flows[i]) : NULL;
+		k_mutex_unlock(&gro_lock);
+
+		gro_deliver(pkt);
+	}
+}
+#endif /* CONFIG_NET_GRO */
+
 static inline enum net_verdict process_data(struct net_pkt *pkt,
 					    bool is_loopback)
 {
@@ -129,6 +521,18 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
+#if defined(CONFIG_NET_GRO)
+		/* Looped back packets are processed in the context of the
+		 * sender, which does not flush the held packets.
+		 */
+		if (!is_loopback && !locally_routed) {
+			ret = gro_receive(pkt);
+			if (ret != NET_CONTINUE) {
+				return ret;
+			}
+		}
+#endif
+
 		/* IP version and header length. */
 		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
 
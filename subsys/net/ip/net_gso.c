@@ -0,0 +1,250 @@
+/** @file
+ * @brief Generic segmentation offload
+ *
+ * TCP can hand over a super-segment, a packet carrying several segments
+ * worth of data. It is split here into segments of the size TCP asked for,
+ * right before the packets are given to the L2 of the interface.
+ */
+
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_if, CONFIG_NET_IF_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_l2.h>
+
+#include "net_private.h"
+#include "net_stats.h"
+#include "tcp_internal.h"
+
+#define NET_BUF_TIMEOUT K_MSEC(100)
+
+static void gso_copy_attributes(struct net_pkt *seg, struct net_pkt *pkt)
+{
+	net_pkt_set_context(seg, net_pkt_context(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_vlan_tag(seg, net_pkt_vlan_tag(pkt));
+	net_pkt_set_orig_iface(seg, net_pkt_orig_iface(pkt));
+	net_pkt_set_ll_proto_type(seg, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+
+	memcpy(net_pkt_lladdr_src(seg), net_pkt_lladdr_src(pkt),
+	       sizeof(struct net_linkaddr));
+	memcpy(net_pkt_lladdr_dst(seg), net_pkt_lladdr_dst(pkt),
+	       sizeof(struct net_linkaddr));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_ttl(seg, net_pkt_ipv4_ttl(pkt));
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(pkt) == AF_INET6) {
+		net_pkt_set_ipv6_hop_limit(seg, net_pkt_ipv6_hop_limit(pkt));
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+	}
+}
+
+/* Fix the headers copied from the super-segment so that they describe
+ * the segment starting at offset in the payload.
+ */
+static int gso_update_headers(struct net_pkt *seg, size_t offset, bool last)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	struct net_if *iface = net_pkt_iface(seg);
+	size_t ip_len = net_pkt_ip_hdr_len(seg) + net_pkt_ip_opts_len(seg);
+	struct tcphdr *th;
+	uint16_t pkt_len;
+
+	net_pkt_set_overwrite(seg, true);
+	net_pkt_cursor_init(seg);
+
+	pkt_len = net_pkt_get_len(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+		struct net_ipv4_hdr *ipv4_hdr;
+
+		ipv4_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(seg, &ipv4_access);
+		if (!ipv4_hdr) {
+			return -ENOBUFS;
+		}
+
+		ipv4_hdr->len = htons(pkt_len);
+		ipv4_hdr->chksum = 0U;
+
+		if (net_if_need_calc_tx_checksum(iface)) {
+			ipv4_hdr->chksum = net_calc_chksum_ipv4(seg);
+		}
+
+		net_pkt_set_data(seg, &ipv4_access);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(seg) == AF_INET6) {
+		NET_PKT_DATA_ACCESS_DEFINE(ipv6_access, struct net_ipv6_hdr);
+		struct net_ipv6_hdr *ipv6_hdr;
+
+		ipv6_hdr = (struct net_ipv6_hdr *)net_pkt_get_data(seg, &ipv6_access);
+		if (!ipv6_hdr) {
+			return -ENOBUFS;
+		}
+
+		ipv6_hdr->len = htons(pkt_len - sizeof(struct net_ipv6_hdr));
+
+		net_pkt_set_data(seg, &ipv6_access);
+	} else {
+		return -EINVAL;
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_skip(seg, ip_len);
+
+	th = (struct tcphdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!th) {
+		return -ENOBUFS;
+	}
+
+	UNALIGNED_PUT(htonl(th_seq(th) + offset), &th->th_seq);
+
+	/* Only the last segment ends the push or the stream */
+	if (!last) {
+		th->th_flags &= ~(PSH | FIN);
+	}
+
+	th->th_sum = 0U;
+
+	net_pkt_set_data(seg, &tcp_access);
+
+	if (net_if_need_calc_tx_checksum(iface)) {
+		net_pkt_cursor_init(seg);
+		net_pkt_skip(seg, ip_len);
+
+		th = (struct tcphdr *)net_pkt_get_data(seg, &tcp_access);
+		if (!th) {
+			return -ENOBUFS;
+		}
+
+		th->th_sum = net_calc_chksum_tcp(seg);
+
+		net_pkt_set_data(seg, &tcp_access);
+	}
+
+	net_pkt_set_overwrite(seg, false);
+	net_pkt_cursor_init(seg);
+
+	return 0;
+}
+
+static struct net_pkt *gso_segment(struct net_pkt *pkt, size_t hdr_len,
+				   size_t offset, size_t len, bool last)
+{
+	struct net_pkt *seg;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len + len,
+					net_pkt_family(pkt), 0,
+					NET_BUF_TIMEOUT);
+	if (!seg) {
+		return NULL;
+	}
+
+	gso_copy_attributes(seg, pkt);
+
+	/* The headers, then this segment's part of the payload */
+	net_pkt_cursor_init(seg);
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		goto fail;
+	}
+
+	if (gso_update_headers(seg, offset, last) < 0) {
+		goto fail;
+	}
+
+	return seg;
+
+fail:
+	net_pkt_unref(seg);
+
+	return NULL;
+}
+
+int net_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint16_t mss = net_pkt_gso_size(pkt);
+	struct net_pkt *seg;
+	struct tcphdr *th;
+	size_t data_len;
+	size_t hdr_len;
+	size_t offset;
+	size_t len;
+	uint32_t segs = 0U;
+	int sent = 0;
+	int ret;
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_skip(pkt, ip_len)) {
+		return -EINVAL;
+	}
+
+	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!th) {
+		return -ENOBUFS;
+	}
+
+	hdr_len = ip_len + th_off(th) * 4U;
+	data_len = net_pkt_get_len(pkt) - hdr_len;
+
+	NET_DBG("Splitting pkt %p len %zu into segments of %u", pkt, data_len,
+		mss);
+
+	for (offset = 0U; offset < data_len; offset += len) {
+		len = MIN(data_len - offset, mss);
+
+		seg = gso_segment(pkt, hdr_len, offset, len,
+				  offset + len == data_len);
+		if (!seg) {
+			NET_DBG("Cannot allocate segment at %zu", offset);
+			ret = -ENOBUFS;
+			break;
+		}
+
+		ret = net_if_l2(iface)->send(iface, seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			break;
+		}
+
+		sent += ret;
+		segs++;
+	}
+
+	if (segs == 0U) {
+		return ret;
+	}
+
+	/* Segments already on the wire cannot be recalled, so a failure
+	 * after the first one is reported as a short send.  TCP still
+	 * holds the rest of the data and retransmits it.
+	 */
+	if (offset < data_len) {
+		NET_DBG("Sent %u segments, %zu of %zu bytes (%d)", segs,
+			offset, data_len, ret);
+	}
+
+	net_stats_update_gso(iface, segs);
+
+	/* Like L2, consume the super-segment once it has been sent */
+	net_pkt_unref(pkt);
+
+	return sent;
+}
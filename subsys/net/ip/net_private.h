@@ -148,11 +148,59 @@ int net_ipv6_send_fragmented_pkt(struct net_if *iface, struct net_pkt *pkt,
 				 uint16_t pkt_len);
 #endif
 
+#if defined(CONFIG_NET_GSO)
+/**
+ * @brief Split a TCP super-segment and send the segments through L2.
+ *
+ * @param iface Network interface the packet is sent to
+ * @param pkt Packet carrying several segments worth of data, see
+ *            net_pkt_gso_size()
+ *
+ * @return Number of bytes sent, the packet has then been released. This
+ *         is short of the whole packet if a segment after the first one
+ *         could not be allocated or sent, the rest of the data is
+ *         dropped and left to TCP retransmission.
+ *         Negative errno if no segment was sent, the caller still owns
+ *         the packet.
+ */
+int net_gso_send(struct net_if *iface, struct net_pkt *pkt);
+#else
+static inline int net_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+
+	return -ENOTSUP;
+}
+#endif
+
+#if defined(CONFIG_NET_GRO)
+/**
+ * @brief Pass up the TCP packets held for coalescing.
+ *
+ * Called by the RX thread once its queue has been drained.
+ */
+void net_gro_flush(void);
+#else
+static inline void net_gro_flush(void) { }
+#endif
+
 extern const char *net_proto2str(int family, int proto);
 extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
+
+/* Architecture checksum hook. Adds the 32-bit words of as much of the
+ * buffer as it handles to *sum, without losing carries, and returns the
+ * number of bytes consumed, always a multiple of 16. calc_chksum() sums
+ * the rest.
+ */
+#if defined(CONFIG_NET_CHKSUM_X86_SSE2) || defined(CONFIG_NET_CHKSUM_ARM64_NEON)
+#define NET_CHKSUM_HW 1
+size_t net_chksum_hw(uint64_t *sum, const uint8_t *data, size_t len);
+#endif
+
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
 
 /**
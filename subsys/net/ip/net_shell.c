@@ -1319,6 +1319,15 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	PR("TCP pkt drop   %d\n", GET_STAT(iface, tcp.drop));
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_SEG_OFFLOAD)
+	PR("GSO pkts       %d\tsegs\t%d\n",
+	   GET_STAT(iface, seg_offload.gso_pkts),
+	   GET_STAT(iface, seg_offload.gso_segs));
+	PR("GRO pkts       %d\tsegs\t%d\n",
+	   GET_STAT(iface, seg_offload.gro_pkts),
+	   GET_STAT(iface, seg_offload.gro_segs));
+#endif
+
 	PR("Bytes received %u\n", GET_STAT(iface, bytes.received));
 	PR("Bytes sent     %u\n", GET_STAT(iface, bytes.sent));
 	PR("Processing err %d\n", GET_STAT(iface, processing_error));
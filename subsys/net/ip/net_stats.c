@@ -302,6 +302,12 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 		len_chk = sizeof(struct net_stats_pm);
 		src = GET_STAT_ADDR(iface, pm);
 		break;
+#endif
+#if defined(CONFIG_NET_STATISTICS_SEG_OFFLOAD)
+	case NET_REQUEST_STATS_GET_SEG_OFFLOAD:
+		len_chk = sizeof(struct net_stats_seg_offload);
+		src = GET_STAT_ADDR(iface, seg_offload);
+		break;
 #endif
 	}
 
@@ -361,6 +367,11 @@ NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_PM,
 				  net_stats_get);
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_SEG_OFFLOAD)
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_SEG_OFFLOAD,
+				  net_stats_get);
+#endif
+
 #endif /* CONFIG_NET_STATISTICS_USER_API */
 
 void net_stats_reset(struct net_if *iface)
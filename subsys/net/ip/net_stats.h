@@ -619,6 +619,23 @@ static inline void net_stats_add_suspend_end_time(struct net_if *iface,
 #define net_stats_add_suspend_end_time(iface, time)
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_SEG_OFFLOAD) && defined(CONFIG_NET_NATIVE)
+static inline void net_stats_update_gso(struct net_if *iface, uint32_t segs)
+{
+	UPDATE_STAT(iface, stats.seg_offload.gso_pkts++);
+	UPDATE_STAT(iface, stats.seg_offload.gso_segs += segs);
+}
+
+static inline void net_stats_update_gro(struct net_if *iface, uint32_t segs)
+{
+	UPDATE_STAT(iface, stats.seg_offload.gro_pkts++);
+	UPDATE_STAT(iface, stats.seg_offload.gro_segs += segs);
+}
+#else
+#define net_stats_update_gso(iface, segs)
+#define net_stats_update_gro(iface, segs)
+#endif /* CONFIG_NET_STATISTICS_SEG_OFFLOAD */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT) \
 	&& defined(CONFIG_NET_NATIVE)
 /* A simple periodic statistic printer, used only in net core */
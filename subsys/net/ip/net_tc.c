@@ -248,6 +248,11 @@ static void tc_rx_handler(struct k_fifo *fifo)
 		}
 
 		net_process_rx_packet(pkt);
+
+		/* Nothing more to coalesce the held packets with */
+		if (IS_ENABLED(CONFIG_NET_GRO) && k_fifo_is_empty(fifo)) {
+			net_gro_flush();
+		}
 	}
 }
 #endif
@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #include <stdlib.h>
 #include <zephyr/kernel.h>
 #include <zephyr/random/rand32.h>
+#include <zephyr/sys/iterable_sections.h>
 
 #if defined(CONFIG_NET_TCP_ISN_RFC6528)
 #include <mbedtls/md5.h>
@@ -402,12 +403,12 @@ static void tcp_derive_rto(struct tcp *conn)
 
 static void tcp_new_reno_log(struct tcp *conn, char *step)
 {
-	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
+	NET_DBG("conn: %p, ca %s, cwnd=%u, ssthres=%u, fast_pend=%u",
 		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
 		conn->ca.pending_fast_retransmit_bytes);
 }
 
-static void tcp_new_reno_init(struct tcp *conn)
+void tcp_new_reno_init(struct tcp *conn)
 {
 	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
 	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
@@ -415,7 +416,7 @@ static void tcp_new_reno_init(struct tcp *conn)
 	tcp_new_reno_log(conn, "init");
 }
 
-static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+void tcp_new_reno_fast_retransmit(struct tcp *conn)
 {
 	if (conn->ca.pending_fast_retransmit_bytes == 0) {
 		conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
@@ -426,7 +427,7 @@ static void tcp_new_reno_fast_retransmit(struct tcp *conn)
 	}
 }
 
-static void tcp_new_reno_timeout(struct tcp *conn)
+void tcp_new_reno_timeout(struct tcp *conn)
 {
 	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
 	conn->ca.cwnd = conn_mss(conn);
@@ -434,19 +435,22 @@ static void tcp_new_reno_timeout(struct tcp *conn)
 }
 
 /* For every duplicate ack increment the cwnd by mss */
-static void tcp_new_reno_dup_ack(struct tcp *conn)
+void tcp_new_reno_dup_ack(struct tcp *conn)
 {
-	int32_t new_win = conn->ca.cwnd;
+	uint32_t new_win = conn->ca.cwnd;
 
 	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	conn->ca.cwnd = MIN(new_win, NET_TCP_MAX_WINDOW);
 	tcp_new_reno_log(conn, "dup_ack");
 }
 
-static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
+void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len,
+			     uint32_t rtt_us)
 {
-	int32_t new_win = conn->ca.cwnd;
-	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+	uint32_t new_win = conn->ca.cwnd;
+	uint32_t win_inc = MIN(acked_len, conn_mss(conn));
+
+	ARG_UNUSED(rtt_us);
 
 	if (conn->ca.pending_fast_retransmit_bytes == 0) {
 		if (conn->ca.cwnd < conn->ca.ssthresh) {
@@ -455,7 +459,7 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			/* Implement a div_ceil	to avoid rounding to 0 */
 			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+		conn->ca.cwnd = MIN(new_win, NET_TCP_MAX_WINDOW);
 	} else {
 		/* Check if it is still in fast recovery mode */
 		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
@@ -463,35 +467,132 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			conn->ca.cwnd = conn->ca.ssthresh;
 		} else {
 			conn->ca.pending_fast_retransmit_bytes -= acked_len;
-			conn->ca.cwnd -= acked_len;
+			conn->ca.cwnd -= MIN(acked_len, conn->ca.cwnd);
 		}
 	}
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, tcp_new_reno) = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+static const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
+{
+	STRUCT_SECTION_FOREACH(tcp_ca_ops, ops) {
+		if (strlen(ops->name) == len && strncmp(ops->name, name, len) == 0) {
+			return ops;
+		}
+	}
+
+	return NULL;
+}
+
+static void tcp_ca_set_default(struct tcp *conn)
+{
+	conn->ca.ops = tcp_ca_find(CONFIG_NET_TCP_CONGESTION_DEFAULT,
+				   strlen(CONFIG_NET_TCP_CONGESTION_DEFAULT));
+	if (conn->ca.ops == NULL) {
+		conn->ca.ops = &tcp_new_reno;
+	}
+}
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca.rtt_pending = false;
+#ifdef CONFIG_NET_TCP_PACING
+	conn->ca.pacing_rate = 0U;
+	conn->ca.next_send = 0;
+#endif
+	memset(conn->ca.priv, 0, sizeof(conn->ca.priv));
+
+	conn->ca.ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	/* Karn's algorithm, the sample could be taken on a retransmission */
+	conn->ca.rtt_pending = false;
+	conn->ca.ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca.rtt_pending = false;
+	conn->ca.ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca.ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	uint32_t rtt_us = 0U;
+
+	if (conn->ca.rtt_pending &&
+	    net_tcp_seq_cmp(conn->seq + acked_len, conn->ca.rtt_seq) >= 0) {
+		rtt_us = k_ticks_to_us_floor32((uint32_t)k_uptime_ticks() -
+					       conn->ca.rtt_start);
+		/* Zero means no sample */
+		rtt_us = MAX(rtt_us, 1U);
+		conn->ca.rtt_pending = false;
+	}
+
+	conn->ca.ops->pkts_acked(conn, acked_len, rtt_us);
+}
+
+/* Time the acknowledgment of new data ending at seq */
+static void tcp_ca_rtt_start(struct tcp *conn, uint32_t seq)
+{
+	if (!conn->ca.rtt_pending) {
+		conn->ca.rtt_seq = seq;
+		conn->ca.rtt_start = (uint32_t)k_uptime_ticks();
+		conn->ca.rtt_pending = true;
+	}
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	const struct tcp_ca_ops *ops;
+
+	/* The name does not have to be NUL terminated */
+	len = strnlen(value, MIN(len, TCP_CA_NAME_MAX));
+
+	ops = tcp_ca_find(value, len);
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops == conn->ca.ops) {
+		return 0;
+	}
+
+	conn->ca.ops = ops;
+
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		tcp_ca_init(conn);
+	}
+
+	return 0;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	if (len == NULL || *len == 0) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, TCP_CA_NAME_MAX);
+	strncpy(value, conn->ca.ops->name, *len);
+
+	return 0;
 }
 #else
 
@@ -505,6 +606,18 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static void tcp_ca_rtt_start(struct tcp *conn, uint32_t seq) { }
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	return -ENOPROTOOPT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	return -ENOPROTOOPT;
+}
+
 #endif
 
 static void tcp_send_queue_flush(struct tcp *conn)
@@ -558,11 +671,24 @@ static int tcp_conn_unref(struct tcp *conn)
 		}
 	}
 
+	k_mutex_unlock(&tcp_lock);
+
+	/* Wait for the packets being delivered to the connection, the
+	 * receive path may need tcp_lock meanwhile.
+	 */
 	if (conn->context->conn_handler) {
 		net_conn_unregister(conn->context->conn_handler);
-		conn->context->conn_handler = NULL;
 	}
 
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+
+	/* Data queued meanwhile has no application to go to */
+	while ((pkt = k_fifo_get(&conn->recv_data, K_NO_WAIT)) != NULL) {
+		tcp_pkt_unref(pkt);
+	}
+
+	conn->context->conn_handler = NULL;
+
 	conn->context->tcp = NULL;
 
 	net_context_unref(conn->context);
@@ -580,6 +706,9 @@ static int tcp_conn_unref(struct tcp *conn)
 	(void)k_work_cancel_delayable(&conn->fin_timer);
 	(void)k_work_cancel_delayable(&conn->persist_timer);
 	(void)k_work_cancel_delayable(&conn->ack_timer);
+#ifdef CONFIG_NET_TCP_PACING
+	(void)k_work_cancel_delayable(&conn->pacing_timer);
+#endif
 
 	sys_slist_find_and_remove(&tcp_conns, &conn->next);
 
@@ -798,8 +927,14 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
+	/* The MSS is only sent in the SYN, so keep it when later segments
+	 * carry other options.
+	 */
 	recv_options->wnd_found = false;
+	recv_options->sack_perm_found = false;
+#ifdef CONFIG_NET_TCP_SACK
+	recv_options->sack_cnt = 0;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -845,9 +980,36 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			recv_options->window = options[2];
 			recv_options->wnd_found = true;
+			NET_DBG("WS=%hu", recv_options->window);
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_OPT:
+			if ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE != 0) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 2; i < opt_len &&
+			     recv_options->sack_cnt < NET_TCP_SACK_MAX_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_sack_block *block =
+					&recv_options->sack[recv_options->sack_cnt++];
+
+				block->left = sys_get_be32(options + i);
+				block->right = sys_get_be32(options + i + 4);
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1021,11 +1183,114 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+/* Smallest shift that makes the window fit into the 16-bit header field */
+static uint8_t tcp_window_shift(uint32_t win)
+{
+	uint8_t shift = 0U;
+
+	while (shift < NET_TCP_MAX_WINDOW_SHIFT && (win >> shift) > UINT16_MAX) {
+		shift++;
+	}
+
+	return shift;
+}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+/* The out-of-order receive queue never has holes, so everything it holds
+ * is reported in a single SACK block.
+ */
+static bool tcp_sack_block_get(struct tcp *conn, uint8_t flags,
+			       struct tcp_sack_block *block)
+{
+	if (!conn->sack_ok || !(flags & ACK) || (flags & SYN) ||
+	    !CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return false;
+	}
+
+	block->left = tcp_get_seq(conn->queue_recv_data->buffer);
+	block->right = block->left + net_pkt_get_len(conn->queue_recv_data);
+
+	return true;
+}
+#endif
+
+/* Length of the options that follow the MSS option, a multiple of 4 */
+static size_t tcp_ext_options_len(struct tcp *conn, uint8_t flags)
+{
+	size_t len = 0;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block block;
+#endif
+
+	if (conn->send_options.wnd_found) {
+		len += NET_TCP_NOP_SIZE + NET_TCP_WINDOW_SCALE_SIZE;
+	}
+
+	if (conn->send_options.sack_perm_found) {
+		len += 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+	}
+
+#ifdef CONFIG_NET_TCP_SACK
+	if (tcp_sack_block_get(conn, flags, &block)) {
+		len += 2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE;
+	}
+#endif
+
+	return len;
+}
+
+static int tcp_ext_options_add(struct tcp *conn, struct net_pkt *pkt,
+			       uint8_t flags)
+{
+	uint8_t opts[20];
+	size_t len = 0;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block block;
+#endif
+
+	if (conn->send_options.wnd_found) {
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_WINDOW_SCALE_OPT;
+		opts[len++] = NET_TCP_WINDOW_SCALE_SIZE;
+		opts[len++] = conn->send_options.window;
+	}
+
+	if (conn->send_options.sack_perm_found) {
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_SACK_PERM_OPT;
+		opts[len++] = NET_TCP_SACK_PERM_SIZE;
+	}
+
+#ifdef CONFIG_NET_TCP_SACK
+	if (tcp_sack_block_get(conn, flags, &block)) {
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_SACK_OPT;
+		opts[len++] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		sys_put_be32(block.left, &opts[len]);
+		len += sizeof(uint32_t);
+		sys_put_be32(block.right, &opts[len]);
+		len += sizeof(uint32_t);
+	}
+#endif
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return net_pkt_write(pkt, opts, len);
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
+	uint32_t win = conn->recv_win;
 
 	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
 	if (!th) {
@@ -1042,8 +1307,17 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 		th->th_off++;
 	}
 
+	th->th_off += tcp_ext_options_len(conn, flags) / sizeof(uint32_t);
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	/* The window of a SYN segment is never scaled */
+	if (!(flags & SYN)) {
+		win >>= conn->rcv_wscale;
+	}
+#endif
+
 	UNALIGNED_PUT(flags, &th->th_flags);
-	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
+	UNALIGNED_PUT(htons(MIN(win, UINT16_MAX)), &th->th_win);
 	UNALIGNED_PUT(htonl(seq), &th->th_seq);
 
 	if (ACK & flags) {
@@ -1154,6 +1428,8 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		alloc_len += sizeof(uint32_t);
 	}
 
+	alloc_len += tcp_ext_options_len(conn, flags);
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1161,6 +1437,11 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	}
 
 	if (data) {
+		/* More than one segment of data is split up before L2 */
+		if (net_pkt_get_len(data) > conn_mss(conn)) {
+			net_pkt_set_gso_size(pkt, conn_mss(conn));
+		}
+
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
@@ -1186,6 +1467,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_ext_options_add(conn, pkt, flags);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1220,6 +1507,56 @@ static void tcp_out(struct tcp *conn, uint8_t flags)
 	(void)tcp_out_ext(conn, flags, NULL /* no data */, conn->seq);
 }
 
+/* Select the options of our SYN. A SYN-ACK only echoes what the peer
+ * offered in its SYN.
+ */
+static void tcp_syn_options_set(struct tcp *conn, bool syn_ack)
+{
+	conn->send_options.mss_found = true;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (!syn_ack || conn->recv_options.wnd_found) {
+		conn->send_options.window = tcp_window_shift(conn->recv_win_max);
+		conn->send_options.wnd_found = true;
+	}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+	conn->send_options.sack_perm_found = !syn_ack ||
+					     conn->recv_options.sack_perm_found;
+#endif
+}
+
+static void tcp_syn_options_clear(struct tcp *conn)
+{
+	conn->send_options.mss_found = false;
+	conn->send_options.wnd_found = false;
+	conn->send_options.sack_perm_found = false;
+}
+
+/* Enable the options both ends have put into their SYN */
+static void tcp_syn_options_negotiate(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (conn->recv_options.wnd_found) {
+		conn->snd_wscale = MIN(conn->recv_options.window,
+				       NET_TCP_MAX_WINDOW_SHIFT);
+		conn->rcv_wscale = conn->send_options.window;
+	} else {
+		conn->snd_wscale = 0U;
+		conn->rcv_wscale = 0U;
+	}
+
+	NET_DBG("conn: %p window shift send %u recv %u", conn,
+		conn->snd_wscale, conn->rcv_wscale);
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+	conn->sack_ok = conn->recv_options.sack_perm_found;
+	NET_DBG("conn: %p SACK %s", conn, conn->sack_ok ? "on" : "off");
+#endif
+}
+
 static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
 {
 	int total = net_pkt_get_len(pkt);
@@ -1294,17 +1631,147 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
-static int tcp_send_data(struct tcp *conn)
+#ifdef CONFIG_NET_TCP_SACK
+static void tcp_sack_clear(struct tcp *conn)
+{
+	conn->sacked_cnt = 0U;
+	conn->sack_recovery = false;
+}
+
+/* Merge a range reported by the peer into the scoreboard */
+static void tcp_sack_insert(struct tcp *conn, uint32_t left, uint32_t right)
+{
+	struct tcp_sack_block *sb = conn->sacked;
+	int i, j;
+
+	/* First block that is not entirely below the new range */
+	for (i = 0; i < conn->sacked_cnt; i++) {
+		if (net_tcp_seq_cmp(sb[i].right, left) >= 0) {
+			break;
+		}
+	}
+
+	/* Absorb the blocks the new range overlaps or touches */
+	for (j = i; j < conn->sacked_cnt; j++) {
+		if (net_tcp_seq_cmp(sb[j].left, right) > 0) {
+			break;
+		}
+
+		if (net_tcp_seq_cmp(sb[j].left, left) < 0) {
+			left = sb[j].left;
+		}
+
+		if (net_tcp_seq_cmp(sb[j].right, right) > 0) {
+			right = sb[j].right;
+		}
+	}
+
+	if (i == j && conn->sacked_cnt == ARRAY_SIZE(conn->sacked)) {
+		/* Forgetting a range only costs a needless retransmission */
+		return;
+	}
+
+	memmove(&sb[i + 1], &sb[j], (conn->sacked_cnt - j) * sizeof(*sb));
+	sb[i].left = left;
+	sb[i].right = right;
+	conn->sacked_cnt += 1 - (j - i);
+}
+
+/* Record the SACK blocks of an incoming segment, ignoring the ones that
+ * do not cover data we have sent and is not yet acknowledged.
+ */
+static void tcp_sack_update(struct tcp *conn)
+{
+	uint32_t snd_max = conn->seq + conn->send_data_total;
+	struct tcp_sack_block *block;
+
+	for (int i = 0; i < conn->recv_options.sack_cnt; i++) {
+		block = &conn->recv_options.sack[i];
+
+		if (net_tcp_seq_cmp(block->left, conn->seq) <= 0 ||
+		    net_tcp_seq_cmp(block->right, block->left) <= 0 ||
+		    net_tcp_seq_cmp(block->right, snd_max) > 0) {
+			continue;
+		}
+
+		NET_DBG("conn: %p SACK %u-%u", conn, block->left, block->right);
+
+		tcp_sack_insert(conn, block->left, block->right);
+	}
+
+	conn->recv_options.sack_cnt = 0U;
+}
+
+/* Drop what the cumulative acknowledgment has covered */
+static void tcp_sack_prune(struct tcp *conn)
+{
+	int i;
+
+	for (i = 0; i < conn->sacked_cnt; i++) {
+		if (net_tcp_seq_cmp(conn->sacked[i].right, conn->seq) > 0) {
+			break;
+		}
+	}
+
+	conn->sacked_cnt -= i;
+	memmove(&conn->sacked[0], &conn->sacked[i],
+		conn->sacked_cnt * sizeof(conn->sacked[0]));
+
+	if (conn->sacked_cnt == 0U) {
+		conn->sack_recovery = false;
+	} else if (net_tcp_seq_cmp(conn->sacked[0].left, conn->seq) < 0) {
+		conn->sacked[0].left = conn->seq;
+	}
+}
+
+/* Move the send point past data the peer already holds */
+static void tcp_sack_skip(struct tcp *conn)
+{
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < conn->sacked_cnt; i++) {
+		if (net_tcp_seq_cmp(conn->sacked[i].left, next) <= 0 &&
+		    net_tcp_seq_cmp(conn->sacked[i].right, next) > 0) {
+			next = conn->sacked[i].right;
+			conn->unacked_len = next - conn->seq;
+		}
+	}
+}
+
+/* Limit a segment starting at the send point to the next SACKed range */
+static int tcp_sack_clip(struct tcp *conn, int len)
+{
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < conn->sacked_cnt; i++) {
+		if (net_tcp_seq_cmp(conn->sacked[i].left, next) > 0) {
+			return MIN(len, (int)(conn->sacked[i].left - next));
+		}
+	}
+
+	return len;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Send up to max_len bytes from the send point, in one packet */
+static int tcp_send_data(struct tcp *conn, int max_len)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+#ifdef CONFIG_NET_TCP_SACK
+	tcp_sack_skip(conn);
+#endif
+
+	len = MIN(tcp_unsent_len(conn), max_len);
 	if (len < 0) {
 		ret = len;
 		goto out;
 	}
+#ifdef CONFIG_NET_TCP_SACK
+	len = tcp_sack_clip(conn, len);
+#endif
 	if (len == 0) {
 		NET_DBG("conn: %p no data to send", conn);
 		ret = -ENODATA;
@@ -1350,12 +1817,121 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* During fast recovery, resend the next hole below the highest SACKed
+ * range, one segment per incoming acknowledgment.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	int unacked_len = conn->unacked_len;
+	uint32_t high;
+
+	if (!conn->sack_recovery || conn->sacked_cnt == 0U) {
+		return;
+	}
+
+	high = conn->sacked[conn->sacked_cnt - 1].left;
+
+	if (net_tcp_seq_cmp(conn->sack_rexmit_seq, conn->seq) < 0) {
+		conn->sack_rexmit_seq = conn->seq;
+	}
+
+	if (net_tcp_seq_cmp(conn->sack_rexmit_seq, high) >= 0) {
+		/* Every hole has been resent once, the RTO handles the rest */
+		return;
+	}
+
+	conn->unacked_len = conn->sack_rexmit_seq - conn->seq;
+
+	if (tcp_send_data(conn, conn_mss(conn)) == 0) {
+		conn->sack_rexmit_seq = conn->seq + conn->unacked_len;
+	}
+
+	conn->unacked_len = MAX(unacked_len, conn->unacked_len);
+}
+#endif
+
+#ifdef CONFIG_NET_TCP_PACING
+/* Check whether the next segment is due. If not, schedule the pacing
+ * timer to resume the transmission. Up to one tick worth of data is sent
+ * in a burst, as the timer cannot be more precise.
+ */
+static bool tcp_pacing_wait(struct tcp *conn)
+{
+	int64_t now = k_ticks_to_us_floor64(k_uptime_ticks());
+	int64_t quantum = k_ticks_to_us_ceil32(1);
+
+	if (conn->ca.pacing_rate == 0U || conn->ca.next_send <= now + quantum) {
+		return false;
+	}
+
+	k_work_schedule_for_queue(&tcp_work_q, &conn->pacing_timer,
+				  K_USEC(conn->ca.next_send - now));
+
+	return true;
+}
+
+static void tcp_pacing_sent(struct tcp *conn, uint32_t len)
+{
+	int64_t now = k_ticks_to_us_floor64(k_uptime_ticks());
+
+	if (conn->ca.pacing_rate == 0U) {
+		return;
+	}
+
+	/* Idle time is not credited, the next burst starts from now */
+	conn->ca.next_send = MAX(conn->ca.next_send, now) +
+			     (int64_t)len * USEC_PER_SEC / conn->ca.pacing_rate;
+}
+#else
+static bool tcp_pacing_wait(struct tcp *conn)
+{
+	return false;
+}
+
+static void tcp_pacing_sent(struct tcp *conn, uint32_t len) { }
+#endif
+
+#ifdef CONFIG_NET_GSO
+/* IP and TCP headers with all their options */
+#define TCP_GSO_HDR_MAX 120
+
+/* How much data to put into one packet, net_if splits it into MSS sized
+ * segments right before L2. When pacing, keep it to about one tick worth
+ * of data so that the bursts stay as short as the pacing timer allows.
+ */
+static int tcp_gso_max_len(struct tcp *conn)
+{
+	uint16_t mss = conn_mss(conn);
+	uint32_t segs = CONFIG_NET_GSO_MAX_SEGMENTS;
+
+#ifdef CONFIG_NET_TCP_PACING
+	if (conn->ca.pacing_rate != 0U) {
+		segs = CLAMP((uint64_t)conn->ca.pacing_rate * k_ticks_to_us_ceil32(1) /
+			     USEC_PER_SEC / mss, 1U, segs);
+	}
+#endif
+
+	/* The length fields of the IP header must not overflow */
+	segs = MIN(segs, (UINT16_MAX - TCP_GSO_HDR_MAX) / mss);
+
+	return mss * segs;
+}
+#else
+static int tcp_gso_max_len(struct tcp *conn)
+{
+	return conn_mss(conn);
+}
+#endif
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
 {
 	int ret = 0;
 	bool subscribe = false;
+	int unacked_len;
+	int max_len;
 
 	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 		goto out;
@@ -1375,10 +1951,21 @@ static int tcp_send_queued_data(struct tcp *conn)
 			}
 		}
 
-		ret = tcp_send_data(conn);
+		if (tcp_pacing_wait(conn)) {
+			break;
+		}
+
+		unacked_len = conn->unacked_len;
+		max_len = tcp_gso_max_len(conn);
+
+		ret = tcp_send_data(conn, max_len);
 		if (ret < 0) {
 			break;
 		}
+
+		tcp_ca_rtt_start(conn, conn->seq + conn->unacked_len);
+		tcp_pacing_sent(conn, MIN(conn->unacked_len - unacked_len,
+					  max_len));
 	}
 
 	if (conn->send_data_total) {
@@ -1398,6 +1985,22 @@ static int tcp_send_queued_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_PACING
+static void tcp_pacing_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, pacing_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		(void)tcp_send_queued_data(conn);
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#endif
+
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -1444,7 +2047,12 @@ static void tcp_resend_data(struct k_work *work)
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
-	ret = tcp_send_data(conn);
+#ifdef CONFIG_NET_TCP_SACK
+	/* The peer may have dropped data it reported earlier (RFC 2018) */
+	tcp_sack_clear(conn);
+#endif
+
+	ret = tcp_send_data(conn, conn_mss(conn));
 	conn->send_data_retries++;
 	if (ret == 0) {
 		if (conn->in_close && conn->send_data_total == 0) {
@@ -1624,7 +2232,8 @@ static struct tcp *tcp_conn_alloc(void)
 	/* Initially set the congestion window at its max size, since only the MSS
 	 * is available as soon as the connection is established
 	 */
-	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.cwnd = NET_TCP_MAX_WINDOW;
+	tcp_ca_set_default(conn);
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -1641,6 +2250,9 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#ifdef CONFIG_NET_TCP_PACING
+	k_work_init_delayable(&conn->pacing_timer, tcp_pacing_timeout);
+#endif
 
 	tcp_conn_ref(conn);
 
@@ -1750,6 +2362,9 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 		net_ipaddr_copy(&conn_old->context->remote, &conn->dst.sa);
 
 		conn->accepted_conn = conn_old;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+		conn->ca.ops = conn_old->ca.ops;
+#endif
 	}
  in:
 	if (conn) {
@@ -2321,6 +2936,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 	if (th) {
 		conn->send_win = ntohs(th_win(th));
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+		/* The window of a SYN segment is never scaled */
+		if (!(th_flags(th) & SYN)) {
+			conn->send_win <<= conn->snd_wscale;
+		}
+#endif
 		if (conn->send_win > conn->send_win_max) {
 			NET_DBG("Lowering send window from %u to %u",
 				conn->send_win, conn->send_win_max);
@@ -2353,10 +2974,11 @@ next_state:
 	case TCP_LISTEN:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
-			conn->send_options.mss_found = true;
+			tcp_syn_options_set(conn, true);
+			tcp_syn_options_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
-			conn->send_options.mss_found = false;
+			tcp_syn_options_clear(conn);
 			conn_seq(conn, + 1);
 			next = TCP_SYN_RECEIVED;
 
@@ -2367,9 +2989,9 @@ next_state:
 						    ACK_TIMEOUT);
 			verdict = NET_OK;
 		} else {
-			conn->send_options.mss_found = true;
+			tcp_syn_options_set(conn, false);
 			tcp_out(conn, SYN);
-			conn->send_options.mss_found = false;
+			tcp_syn_options_clear(conn);
 			conn_seq(conn, + 1);
 			next = TCP_SYN_SENT;
 		}
@@ -2433,6 +3055,7 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+			tcp_syn_options_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -2500,6 +3123,12 @@ next_state:
 			break;
 		}
 
+#ifdef CONFIG_NET_TCP_SACK
+		if (th && conn->sack_ok) {
+			tcp_sack_update(conn);
+		}
+#endif
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -2525,7 +3154,13 @@ next_state:
 
 				conn->unacked_len = 0;
 
-				(void)tcp_send_data(conn);
+				(void)tcp_send_data(conn, conn_mss(conn));
+
+#ifdef CONFIG_NET_TCP_SACK
+				/* Keep filling the holes on the following ACKs */
+				conn->sack_rexmit_seq = conn->seq + conn->unacked_len;
+				conn->sack_recovery = conn->sacked_cnt > 0U;
+#endif
 
 				/* Restore the current transmission */
 				conn->unacked_len = temp_unacked_len;
@@ -2534,6 +3169,10 @@ next_state:
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+#ifdef CONFIG_NET_TCP_SACK
+			} else if (len == 0 && conn->data_mode == TCP_DATA_MODE_SEND) {
+				tcp_sack_retransmit(conn);
+#endif
 			}
 		}
 #endif
@@ -2580,6 +3219,10 @@ next_state:
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+#ifdef CONFIG_NET_TCP_SACK
+			tcp_sack_prune(conn);
+#endif
+
 			conn_send_data_dump(conn);
 
 			conn->send_data_retries = 0;
@@ -2604,6 +3247,11 @@ next_state:
 				break;
 			}
 
+#ifdef CONFIG_NET_TCP_SACK
+			/* A partial ACK in recovery, resend the next hole */
+			tcp_sack_retransmit(conn);
+#endif
+
 			ret = tcp_send_queued_data(conn);
 			if (ret < 0 && ret != -ENOBUFS) {
 				tcp_out(conn, RST);
@@ -3381,7 +4029,7 @@ int net_tcp_accept(struct net_context *context, net_tcp_accept_cb_t cb,
 	/* Remove the temporary connection handler and register
 	 * a proper now as we have an established connection.
 	 */
-	net_conn_unregister(context->conn_handler);
+	net_conn_unregister_nowait(context->conn_handler);
 
 	return net_conn_register(net_context_get_proto(context),
 				 local_addr.sa_family,
@@ -3421,7 +4069,9 @@ int net_tcp_finalize(struct net_pkt *pkt)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+	/* A super-segment gets a checksum per segment when it is split */
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt)) &&
+	    net_pkt_gso_size(pkt) == 0U) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 	}
 
@@ -3433,8 +4083,13 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 {
 	struct net_tcp_hdr *tcp_hdr;
 
+	/* The segments of a coalesced packet have been verified one by one
+	 * when they were merged, and a super-segment that is looped back
+	 * never had a checksum.
+	 */
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
 	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt)) &&
+	    net_pkt_gso_size(pkt) == 0U &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
 		goto drop;
@@ -3787,6 +4442,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_NODELAY:
 		ret = set_tcp_nodelay(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -3812,6 +4470,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_NODELAY:
 		ret = get_tcp_nodelay(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
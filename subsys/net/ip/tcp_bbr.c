@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* BBR-style congestion control.
+ *
+ * Instead of reacting to loss, the sender keeps a model of the path: the
+ * bottleneck bandwidth, the maximum delivery rate seen over the last few
+ * round trips, and the minimum round trip time seen over the last ten
+ * seconds. Segments are paced at a multiple of the bandwidth and the
+ * window is set to a multiple of the bandwidth-delay product.
+ *
+ * This is a reduced version of BBR v1: a round trip ends whenever the
+ * stack takes a round trip time sample, and the delivery rate is measured
+ * over that round trip rather than per segment.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include "tcp_internal.h"
+
+/* Gains are fixed point, 256 is 1.0 */
+#define BBR_UNIT 256
+#define BBR_HIGH_GAIN 739  /* 2 / ln(2) */
+#define BBR_DRAIN_GAIN 88  /* 1 / BBR_HIGH_GAIN */
+#define BBR_CWND_GAIN 512
+
+/* Round trips the bandwidth filter spans */
+#define BBR_BW_ROUNDS 8
+/* Round trips without 25% bandwidth growth before the pipe is full */
+#define BBR_FULL_BW_ROUNDS 3
+#define BBR_MIN_RTT_WIN_MS 10000
+#define BBR_PROBE_RTT_MS 200
+#define BBR_MIN_CWND_SEGS 4
+
+enum bbr_mode {
+	BBR_STARTUP,    /* ramp up to the bottleneck bandwidth */
+	BBR_DRAIN,      /* drain the queue built during startup */
+	BBR_PROBE_BW,   /* cycle the pacing gain around the bandwidth */
+	BBR_PROBE_RTT,  /* shrink the window to measure the minimum RTT */
+};
+
+static const uint16_t bbr_pacing_gain[] = {
+	320, 192, 256, 256, 256, 256, 256, 256,
+};
+
+struct bbr {
+	uint32_t bw[BBR_BW_ROUNDS]; /* delivery rate per round, bytes/s */
+	uint32_t min_rtt_us;
+	uint32_t min_rtt_stamp;     /* in ms */
+	uint32_t round_start;       /* in us */
+	uint32_t round_delivered;
+	uint32_t full_bw;
+	uint32_t probe_rtt_done;    /* in ms */
+	uint8_t round;
+	uint8_t mode;
+	uint8_t cycle;
+	uint8_t full_bw_cnt;
+};
+
+BUILD_ASSERT(sizeof(struct bbr) <= TCP_CA_PRIV_SIZE);
+
+static inline uint32_t bbr_now_us(void)
+{
+	return k_ticks_to_us_floor32(k_uptime_ticks());
+}
+
+static uint32_t bbr_max_bw(struct bbr *bbr)
+{
+	uint32_t bw = 0U;
+
+	for (int i = 0; i < ARRAY_SIZE(bbr->bw); i++) {
+		bw = MAX(bw, bbr->bw[i]);
+	}
+
+	return bw;
+}
+
+static uint32_t bbr_bdp(struct bbr *bbr)
+{
+	return (uint64_t)bbr_max_bw(bbr) * bbr->min_rtt_us / USEC_PER_SEC;
+}
+
+static void bbr_log(struct tcp *conn, char *step)
+{
+	struct bbr *bbr = tcp_ca_priv(conn);
+
+	NET_DBG("conn: %p, bbr %s, mode=%u, cwnd=%u, bw=%u, min_rtt=%u, pacing=%u",
+		conn, step, bbr->mode, conn->ca.cwnd, bbr_max_bw(bbr),
+		bbr->min_rtt_us, conn->ca.pacing_rate);
+}
+
+static void bbr_init(struct tcp *conn)
+{
+	struct bbr *bbr = tcp_ca_priv(conn);
+
+	/* No pacing until the first bandwidth sample */
+	conn->ca.cwnd = conn_mss(conn) * BBR_MIN_CWND_SEGS;
+	conn->ca.ssthresh = NET_TCP_MAX_WINDOW;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	bbr->mode = BBR_STARTUP;
+	bbr->round_start = bbr_now_us();
+	bbr->min_rtt_stamp = k_uptime_get_32();
+	bbr_log(conn, "init");
+}
+
+/* Loss is not a congestion signal, the model takes care of it */
+static void bbr_fast_retransmit(struct tcp *conn)
+{
+	bbr_log(conn, "fast_retransmit");
+}
+
+static void bbr_timeout(struct tcp *conn)
+{
+	/* Restart from one segment, the window grows back to the model
+	 * within a few round trips.
+	 */
+	conn->ca.cwnd = conn_mss(conn);
+	bbr_log(conn, "timeout");
+}
+
+static void bbr_dup_ack(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void bbr_check_full_pipe(struct bbr *bbr)
+{
+	uint32_t bw = bbr_max_bw(bbr);
+
+	if (bw >= bbr->full_bw + bbr->full_bw / 4) {
+		bbr->full_bw = bw;
+		bbr->full_bw_cnt = 0U;
+		return;
+	}
+
+	if (++bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS) {
+		bbr->mode = BBR_DRAIN;
+	}
+}
+
+static void bbr_update_min_rtt(struct tcp *conn, uint32_t rtt_us)
+{
+	struct bbr *bbr = tcp_ca_priv(conn);
+	uint32_t now = k_uptime_get_32();
+	bool expired = (now - bbr->min_rtt_stamp) > BBR_MIN_RTT_WIN_MS;
+
+	if (bbr->min_rtt_us == 0U || rtt_us <= bbr->min_rtt_us || expired) {
+		bbr->min_rtt_us = rtt_us;
+		bbr->min_rtt_stamp = now;
+	}
+
+	if (expired && bbr->mode != BBR_PROBE_RTT) {
+		bbr->mode = BBR_PROBE_RTT;
+		bbr->probe_rtt_done = now + MAX(BBR_PROBE_RTT_MS,
+						rtt_us / USEC_PER_MSEC);
+	} else if (bbr->mode == BBR_PROBE_RTT &&
+		   (int32_t)(now - bbr->probe_rtt_done) >= 0) {
+		bbr->min_rtt_stamp = now;
+		bbr->mode = bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS ?
+			    BBR_PROBE_BW : BBR_STARTUP;
+	}
+}
+
+/* End of a round trip: take a bandwidth sample and advance the state */
+static void bbr_round_end(struct tcp *conn, uint32_t rtt_us)
+{
+	struct bbr *bbr = tcp_ca_priv(conn);
+	uint32_t now = bbr_now_us();
+	uint32_t elapsed = MAX(now - bbr->round_start, 1U);
+
+	bbr->round = (bbr->round + 1U) % BBR_BW_ROUNDS;
+	bbr->bw[bbr->round] = (uint64_t)bbr->round_delivered * USEC_PER_SEC /
+			      elapsed;
+	bbr->round_delivered = 0U;
+	bbr->round_start = now;
+
+	bbr_update_min_rtt(conn, rtt_us);
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		bbr_check_full_pipe(bbr);
+		break;
+	case BBR_DRAIN:
+		if (conn->unacked_len <= bbr_bdp(bbr)) {
+			bbr->mode = BBR_PROBE_BW;
+			bbr->cycle = 2U;
+		}
+		break;
+	case BBR_PROBE_BW:
+		bbr->cycle = (bbr->cycle + 1U) % ARRAY_SIZE(bbr_pacing_gain);
+		break;
+	default:
+		break;
+	}
+}
+
+static void bbr_set_rates(struct tcp *conn, uint32_t acked_len)
+{
+	struct bbr *bbr = tcp_ca_priv(conn);
+	uint32_t mss = conn_mss(conn);
+	uint32_t bw = bbr_max_bw(bbr);
+	uint32_t cwnd = conn->ca.cwnd + acked_len;
+	uint32_t pacing_gain;
+	uint64_t target;
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		pacing_gain = BBR_HIGH_GAIN;
+		break;
+	case BBR_DRAIN:
+		pacing_gain = BBR_DRAIN_GAIN;
+		break;
+	case BBR_PROBE_BW:
+		pacing_gain = bbr_pacing_gain[bbr->cycle];
+		break;
+	default:
+		pacing_gain = BBR_UNIT;
+		break;
+	}
+
+	if (bw != 0U) {
+		conn->ca.pacing_rate = CLAMP((uint64_t)bw * pacing_gain / BBR_UNIT,
+					     1U, UINT32_MAX);
+
+		target = (uint64_t)bbr_bdp(bbr) *
+			 (bbr->mode == BBR_PROBE_BW ? BBR_CWND_GAIN : BBR_HIGH_GAIN) /
+			 BBR_UNIT + 3 * mss;
+
+		/* Until the pipe is full, only grow */
+		if (bbr->mode == BBR_STARTUP) {
+			cwnd = conn->ca.cwnd < target ? cwnd : conn->ca.cwnd;
+		} else {
+			cwnd = MIN(cwnd, target);
+		}
+	}
+
+	cwnd = MAX(cwnd, mss * BBR_MIN_CWND_SEGS);
+
+	if (bbr->mode == BBR_PROBE_RTT) {
+		cwnd = mss * BBR_MIN_CWND_SEGS;
+	}
+
+	conn->ca.cwnd = MIN(cwnd, NET_TCP_MAX_WINDOW);
+}
+
+static void bbr_pkts_acked(struct tcp *conn, uint32_t acked_len,
+			   uint32_t rtt_us)
+{
+	struct bbr *bbr = tcp_ca_priv(conn);
+
+	bbr->round_delivered += acked_len;
+
+	if (rtt_us != 0U) {
+		bbr_round_end(conn, rtt_us);
+	}
+
+	bbr_set_rates(conn, acked_len);
+	bbr_log(conn, "pkts_acked");
+}
+
+static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, tcp_bbr) = {
+	.name = "bbr",
+	.init = bbr_init,
+	.fast_retransmit = bbr_fast_retransmit,
+	.timeout = bbr_timeout,
+	.dup_ack = bbr_dup_ack,
+	.pkts_acked = bbr_pkts_acked,
+};
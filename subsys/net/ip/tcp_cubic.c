@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, RFC 9438.
+ *
+ * After a loss the window follows W(t) = C * (t - K)^3 + W_max, where
+ * W_max is the window when the loss happened and K the time it takes to
+ * grow back to it. The window thus recovers quickly, stays around W_max
+ * for a while and then probes for more bandwidth. Fast recovery itself
+ * is the one of New Reno.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include "tcp_internal.h"
+
+/* C = 0.4 segments per second cubed, beta = 0.7 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* Bound t - K so that the cube cannot overflow */
+#define CUBIC_MAX_DELTA_MS 60000
+
+struct cubic {
+	uint32_t w_max;       /* window at the last loss */
+	uint32_t origin;      /* window at the plateau of the curve */
+	uint32_t w_est;       /* window New Reno would have */
+	uint32_t k;           /* time to reach the plateau, in ms */
+	uint32_t epoch_start; /* start of the current curve, in ms */
+	uint32_t min_rtt_us;
+	bool in_epoch;
+};
+
+BUILD_ASSERT(sizeof(struct cubic) <= TCP_CA_PRIV_SIZE);
+
+/* Integer cube root, from Hacker's Delight */
+static uint32_t cubic_root(uint64_t x)
+{
+	uint64_t y = 0U;
+	uint64_t b;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		y += y;
+		b = 3U * y * (y + 1U) + 1U;
+		if ((x >> s) >= b) {
+			x -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+static void cubic_log(struct tcp *conn, char *step)
+{
+	struct cubic *ca = tcp_ca_priv(conn);
+
+	NET_DBG("conn: %p, cubic %s, cwnd=%u, ssthres=%u, w_max=%u, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh, ca->w_max, ca->k);
+}
+
+static void cubic_init(struct tcp *conn)
+{
+	tcp_new_reno_init(conn);
+}
+
+/* Multiplicative decrease, common to both kinds of loss */
+static void cubic_reduce(struct tcp *conn)
+{
+	struct cubic *ca = tcp_ca_priv(conn);
+	uint32_t mss = conn_mss(conn);
+	uint32_t win = MIN(conn->ca.cwnd, (uint32_t)conn->unacked_len);
+
+	/* Fast convergence, leave room to the flows that are growing */
+	if (win < ca->w_max) {
+		ca->w_max = (uint64_t)win * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+			    (2 * CUBIC_BETA_DEN);
+	} else {
+		ca->w_max = win;
+	}
+
+	ca->in_epoch = false;
+	conn->ca.ssthresh = MAX(mss * 2,
+				(uint64_t)win * CUBIC_BETA_NUM / CUBIC_BETA_DEN);
+}
+
+static void cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void cubic_timeout(struct tcp *conn)
+{
+	cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	cubic_log(conn, "timeout");
+}
+
+static void cubic_dup_ack(struct tcp *conn)
+{
+	tcp_new_reno_dup_ack(conn);
+}
+
+static void cubic_epoch_start(struct tcp *conn, uint32_t now)
+{
+	struct cubic *ca = tcp_ca_priv(conn);
+	uint32_t mss = conn_mss(conn);
+
+	ca->in_epoch = true;
+	ca->epoch_start = now;
+	ca->w_est = conn->ca.cwnd;
+
+	if (conn->ca.cwnd < ca->w_max) {
+		/* K^3 = (W_max - cwnd) / C, in ms^3 */
+		ca->k = cubic_root((uint64_t)(ca->w_max - conn->ca.cwnd) *
+				   2500000000ULL / mss);
+		ca->origin = ca->w_max;
+	} else {
+		ca->k = 0U;
+		ca->origin = conn->ca.cwnd;
+	}
+}
+
+/* Congestion avoidance, move cwnd towards W(t + RTT) */
+static void cubic_update(struct tcp *conn, uint32_t acked_len)
+{
+	struct cubic *ca = tcp_ca_priv(conn);
+	uint32_t now = k_uptime_get_32();
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	int64_t delta;
+	int64_t target;
+
+	if (!ca->in_epoch) {
+		cubic_epoch_start(conn, now);
+	}
+
+	delta = (int64_t)(now - ca->epoch_start) + ca->min_rtt_us / USEC_PER_MSEC -
+		ca->k;
+	delta = CLAMP(delta, -CUBIC_MAX_DELTA_MS, CUBIC_MAX_DELTA_MS);
+
+	/* C * delta^3 * mss with delta in ms */
+	target = (int64_t)ca->origin +
+		 (delta * delta * delta / MSEC_PER_SEC) * mss / 2500000;
+
+	/* Grow at most by half a window per round trip */
+	target = CLAMP(target, (int64_t)cwnd, (int64_t)cwnd + cwnd / 2);
+
+	/* The Reno-friendly region, 3 * (1 - beta) / (1 + beta) = 9 / 17 */
+	ca->w_est += (uint64_t)MIN(acked_len, mss) * mss * 9 / (17 * (uint64_t)cwnd);
+	if (ca->w_est > target) {
+		target = ca->w_est;
+	}
+
+	cwnd += (uint64_t)(target - cwnd) * MIN(acked_len, mss) / cwnd;
+	conn->ca.cwnd = MIN(cwnd, NET_TCP_MAX_WINDOW);
+}
+
+static void cubic_pkts_acked(struct tcp *conn, uint32_t acked_len,
+			     uint32_t rtt_us)
+{
+	struct cubic *ca = tcp_ca_priv(conn);
+
+	if (rtt_us != 0U && (ca->min_rtt_us == 0U || rtt_us < ca->min_rtt_us)) {
+		ca->min_rtt_us = rtt_us;
+	}
+
+	if (conn->ca.pending_fast_retransmit_bytes != 0) {
+		/* Fast recovery */
+		tcp_new_reno_pkts_acked(conn, acked_len, rtt_us);
+		return;
+	}
+
+	if (conn->ca.cwnd < conn->ca.ssthresh) {
+		conn->ca.cwnd = MIN(conn->ca.cwnd + MIN(acked_len, conn_mss(conn)),
+				    NET_TCP_MAX_WINDOW);
+	} else {
+		cubic_update(conn, acked_len);
+	}
+
+	cubic_log(conn, "pkts_acked");
+}
+
+static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, tcp_cubic) = {
+	.name = "cubic",
+	.init = cubic_init,
+	.fast_retransmit = cubic_fast_retransmit,
+	.timeout = cubic_timeout,
+	.dup_ack = cubic_dup_ack,
+	.pkts_acked = cubic_pkts_acked,
+};
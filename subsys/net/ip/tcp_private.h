@@ -129,7 +129,7 @@
 #define conn_send_data_dump(_conn)                                             \
 	({                                                                     \
 		NET_DBG("conn: %p total=%zd, unacked_len=%d, "                 \
-			"send_win=%hu, mss=%hu",                               \
+			"send_win=%u, mss=%hu",                                \
 			(_conn), net_pkt_get_len((_conn)->send_data),          \
 			_conn->unacked_len, _conn->send_win,                   \
 			(uint16_t)conn_mss((_conn)));                          \
@@ -209,27 +209,100 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Largest window shift allowed by RFC 7323 */
+#define NET_TCP_MAX_WINDOW_SHIFT 14
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+#define NET_TCP_MAX_WINDOW (UINT16_MAX << NET_TCP_MAX_WINDOW_SHIFT)
+#else
+#define NET_TCP_MAX_WINDOW UINT16_MAX
+#endif
+
+/* A SACK option fits at most four blocks into the option space */
+#define NET_TCP_SACK_MAX_BLOCKS 4
+
+struct tcp_sack_block {
+	uint32_t left;
+	uint32_t right;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_cnt;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-struct tcp_collision_avoidance_reno {
-	uint16_t cwnd;
-	uint16_t ssthresh;
-	uint16_t pending_fast_retransmit_bytes;
+#define TCP_CA_NAME_MAX 16
+
+/* Room for the private state of a congestion control module */
+#define TCP_CA_PRIV_SIZE 64
+
+struct tcp;
+
+/* Congestion control module, register with STRUCT_SECTION_ITERABLE() */
+struct tcp_ca_ops {
+	/* Name used to select the module with TCP_CONGESTION */
+	const char *name;
+	/* Connection established, set up the initial window */
+	void (*init)(struct tcp *conn);
+	/* Three duplicate acknowledgments, a segment was lost */
+	void (*fast_retransmit)(struct tcp *conn);
+	/* Retransmission timer expired */
+	void (*timeout)(struct tcp *conn);
+	/* Acknowledgment that does not advance the window */
+	void (*dup_ack)(struct tcp *conn);
+	/* New data acknowledged. rtt_us is a round trip time sample taken
+	 * on data that was not retransmitted, or 0 when there is none.
+	 */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len,
+			   uint32_t rtt_us);
 };
+
+struct tcp_collision_avoidance {
+	const struct tcp_ca_ops *ops;
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	uint32_t pending_fast_retransmit_bytes;
+	/* Round trip time measurement, one segment at a time */
+	uint32_t rtt_seq;
+	uint32_t rtt_start; /* in ticks */
+	bool rtt_pending;
+#ifdef CONFIG_NET_TCP_PACING
+	/* Bytes per second, 0 disables pacing */
+	uint32_t pacing_rate;
+	int64_t next_send; /* uptime in microseconds */
+#endif
+	uint64_t priv[TCP_CA_PRIV_SIZE / sizeof(uint64_t)];
+};
+
+#define tcp_ca_priv(_conn) ((void *)(_conn)->ca.priv)
+
+/* New Reno, the default module, which the others can build upon */
+void tcp_new_reno_init(struct tcp *conn);
+void tcp_new_reno_fast_retransmit(struct tcp *conn);
+void tcp_new_reno_timeout(struct tcp *conn);
+void tcp_new_reno_dup_ack(struct tcp *conn);
+void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len,
+			     uint32_t rtt_us);
 #endif
 
 struct tcp { /* TCP connection */
@@ -276,21 +349,41 @@ struct tcp { /* TCP connection */
 	enum tcp_data_mode data_mode;
 	uint32_t seq;
 	uint32_t ack;
-	uint16_t recv_win_max;
-	uint16_t recv_win;
-	uint16_t send_win_max;
-	uint16_t send_win;
+	uint32_t recv_win_max;
+	uint32_t recv_win;
+	uint32_t send_win_max;
+	uint32_t send_win;
+#ifdef CONFIG_NET_TCP_SACK
+	/* Ranges above seq the peer has selectively acknowledged, sorted
+	 * and disjoint.
+	 */
+	struct tcp_sack_block sacked[NET_TCP_SACK_MAX_BLOCKS];
+	/* Everything below this has been retransmitted in SACK recovery */
+	uint32_t sack_rexmit_seq;
+	uint8_t sacked_cnt;
+#endif
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	struct tcp_collision_avoidance_reno ca;
+	struct tcp_collision_avoidance ca;
+#endif
+#ifdef CONFIG_NET_TCP_PACING
+	struct k_work_delayable pacing_timer;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	uint8_t dup_ack_cnt;
 #endif
 	uint8_t zwp_retries;
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	uint8_t snd_wscale; /* shift applied to the windows the peer sends */
+	uint8_t rcv_wscale; /* shift applied to the windows we advertise */
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_ok : 1;
+	bool sack_recovery : 1;
+#endif
 	bool in_retransmission : 1;
 	bool in_connect : 1;
 	bool in_close : 1;
@@ -505,6 +505,16 @@ static uint16_t offset_based_swap8(const uint8_t *data)
 	}
 }
 
+#if defined(CONFIG_64BIT)
+static inline uint64_t chksum_add64(uint64_t sum, uint64_t data)
+{
+	sum += data;
+
+	/* End around carry */
+	return sum + (sum < data);
+}
+#endif
+
 /* Word based checksum calculation based on:
  * https://blogs.igalia.com/dpino/2018/06/14/fast-checksum-computation/
  * It’s not necessary to add octets as 16-bit words. Due to the associative property of addition,
@@ -529,7 +539,7 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 		sum = sum_in;
 	}
 
-	/* Process up to 3 data elements up front, so the data is aligned further down the line */
+	/* Process up to 7 data elements up front, so the data is aligned further down the line */
 	if ((((uintptr_t)data & 0x01) != 0) && (pending >= 1)) {
 		sum += offset_based_swap8(data);
 		data++;
@@ -540,17 +550,50 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 		sum = sum + *((uint16_t *)data);
 		data += sizeof(uint16_t);
 	}
+	if ((((uintptr_t)data & 0x04) != 0) && (pending >= sizeof(uint32_t))) {
+		pending -= sizeof(uint32_t);
+		sum = sum + *((uint32_t *)data);
+		data += sizeof(uint32_t);
+	}
+
+#if defined(NET_CHKSUM_HW)
+	i = net_chksum_hw(&sum, data, pending);
+	pending -= i;
+	data += i;
+	i = 0;
+#endif
+
+#if defined(CONFIG_64BIT)
+	/* Full 64-bit words, adding the carries back in */
+	while (pending >= sizeof(uint64_t) * 4) {
+		const uint64_t *p64 = (const uint64_t *)data;
+
+		pending -= sizeof(uint64_t) * 4;
+		sum = chksum_add64(sum, p64[0]);
+		sum = chksum_add64(sum, p64[1]);
+		sum = chksum_add64(sum, p64[2]);
+		sum = chksum_add64(sum, p64[3]);
+		data += sizeof(uint64_t) * 4;
+	}
+
+	/* Leave room for the 32-bit words below */
+	sum = (sum & 0xffffffff) + (sum >> 32);
+#endif
 	p = (uint32_t *)data;
 
 	/* Do loop unrolling for the very large data sets */
-	while (pending >= sizeof(uint32_t) * 4) {
+	while (pending >= sizeof(uint32_t) * 8) {
 		uint64_t sum_a = p[i];
 		uint64_t sum_b = p[i + 1];
 
-		pending -= sizeof(uint32_t) * 4;
+		pending -= sizeof(uint32_t) * 8;
 		sum_a += p[i + 2];
 		sum_b += p[i + 3];
-		i += 4;
+		sum_a += p[i + 4];
+		sum_b += p[i + 5];
+		sum_a += p[i + 6];
+		sum_b += p[i + 7];
+		i += 8;
 		sum += sum_a + sum_b;
 	}
 	while (pending >= sizeof(uint32_t)) {
@@ -17,6 +17,7 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/net_core.h>
+#include <zephyr/net/net_stats.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/zperf.h>
 
@@ -426,6 +427,69 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 	}
 }
 
+#if defined(CONFIG_NET_STATISTICS_SEG_OFFLOAD) && \
+	defined(CONFIG_NET_STATISTICS_TCP) && defined(CONFIG_NET_STATISTICS_USER_API)
+/* With GSO and GRO, the IP stack handles fewer packets than there are
+ * TCP segments on the wire. Show both rates next to the byte rate.
+ */
+struct pkt_rate_stats {
+	struct net_stats_tcp tcp;
+	struct net_stats_seg_offload seg_offload;
+};
+
+static struct pkt_rate_stats pkt_rate_start;
+
+static void pkt_rate_stats_get(struct pkt_rate_stats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+
+	/* Totals of all the interfaces */
+	(void)net_mgmt(NET_REQUEST_STATS_GET_TCP, NULL, &stats->tcp,
+		       sizeof(stats->tcp));
+	(void)net_mgmt(NET_REQUEST_STATS_GET_SEG_OFFLOAD, NULL,
+		       &stats->seg_offload, sizeof(stats->seg_offload));
+}
+
+static void pkt_rate_begin(void)
+{
+	pkt_rate_stats_get(&pkt_rate_start);
+}
+
+static void pkt_rate_print(const struct shell *sh, bool upload,
+			   uint64_t time_in_us)
+{
+	struct pkt_rate_stats now;
+	uint32_t pkts;
+	uint32_t segs;
+
+	if (time_in_us == 0U) {
+		return;
+	}
+
+	pkt_rate_stats_get(&now);
+
+	if (upload) {
+		pkts = now.tcp.sent - pkt_rate_start.tcp.sent;
+		segs = pkts +
+		       (now.seg_offload.gso_segs - pkt_rate_start.seg_offload.gso_segs) -
+		       (now.seg_offload.gso_pkts - pkt_rate_start.seg_offload.gso_pkts);
+	} else {
+		pkts = now.tcp.recv - pkt_rate_start.tcp.recv;
+		segs = pkts +
+		       (now.seg_offload.gro_segs - pkt_rate_start.seg_offload.gro_segs) -
+		       (now.seg_offload.gro_pkts - pkt_rate_start.seg_offload.gro_pkts);
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "Stack pkts/s:\t%u\n",
+		      (uint32_t)((uint64_t)pkts * USEC_PER_SEC / time_in_us));
+	shell_fprintf(sh, SHELL_NORMAL, "Wire segs/s:\t%u\n",
+		      (uint32_t)((uint64_t)segs * USEC_PER_SEC / time_in_us));
+}
+#else
+#define pkt_rate_begin()
+#define pkt_rate_print(sh, upload, time_in_us)
+#endif
+
 static void shell_tcp_upload_print_stats(const struct shell *sh,
 					 struct zperf_results *results)
 {
@@ -456,6 +520,7 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+		pkt_rate_print(sh, true, results->client_time_in_us);
 	}
 }
 
@@ -573,6 +638,8 @@ static int execute_upload(const struct shell *sh,
 	}
 
 	if (!is_udp && IS_ENABLED(CONFIG_NET_TCP)) {
+		pkt_rate_begin();
+
 		if (async) {
 			ret = zperf_tcp_upload_async(param, tcp_upload_cb,
 						     (void *)sh);
@@ -1015,6 +1082,7 @@ static void tcp_session_cb(enum zperf_status status,
 	switch (status) {
 	case ZPERF_SESSION_STARTED:
 		shell_fprintf(sh, SHELL_NORMAL, "New TCP session started.\n");
+		pkt_rate_begin();
 		break;
 
 	case ZPERF_SESSION_FINISHED: {
@@ -1039,6 +1107,7 @@ static void tcp_session_cb(enum zperf_status status,
 		shell_fprintf(sh, SHELL_NORMAL, " rate:\t\t\t");
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+		pkt_rate_print(sh, false, result->time_in_us);
 
 		break;
 	}
@@ -244,6 +244,63 @@ static int cmd_kernel_stacks(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_SCHED_RUNQ_LATENCY) && defined(CONFIG_THREAD_MONITOR)
+static void shell_runq_latency_dump(const struct k_thread *cthread,
+				    void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	struct k_runq_latency_stats stats;
+	const char *tname;
+	uint32_t count = 0U;
+
+	if (k_thread_runq_latency_get(thread, &stats) != 0) {
+		return;
+	}
+
+	for (int i = 0; i < K_RUNQ_LATENCY_BUCKETS; i++) {
+		count += stats.buckets[i];
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(sh, "%p %-" STRINGIFY(THREAD_MAX_NAM_LEN) "s "
+		    "wakeups %u avg %u max %u cycles",
+		    thread, tname ? tname : "NA", count,
+		    (count != 0U) ? (uint32_t)(stats.total / count) : 0U,
+		    stats.max);
+
+	for (int i = 0; i < K_RUNQ_LATENCY_BUCKETS; i++) {
+		if (stats.buckets[i] != 0U) {
+			shell_print(sh, "\t< 2^%-2d cycles: %u", i + 1,
+				    stats.buckets[i]);
+		}
+	}
+}
+
+static int cmd_kernel_thread_latency(const struct shell *sh,
+				     size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Ready-to-running latency (hw cycles):");
+
+#ifdef CONFIG_SMP
+	k_thread_foreach_unlocked(shell_runq_latency_dump, (void *)sh);
+#else
+	k_thread_foreach(shell_runq_latency_dump, (void *)sh);
+#endif
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_thread,
+	SHELL_CMD(latency, NULL, "Run queue latency histograms.",
+		  cmd_kernel_thread_latency),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+#endif
+
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 extern struct sys_heap _system_heap;
 
@@ -368,6 +425,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 	SHELL_CMD(stacks, NULL, "List threads stack usage.", cmd_kernel_stacks),
 	SHELL_CMD(threads, NULL, "List kernel threads.", cmd_kernel_threads),
 #endif
+#if defined(CONFIG_SCHED_RUNQ_LATENCY) && defined(CONFIG_THREAD_MONITOR)
+	SHELL_CMD(thread, &sub_kernel_thread, "Thread statistics.", NULL),
+#endif
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 	SHELL_CMD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap),
 #endif
@@ -135,6 +135,11 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_work_submit_to_queue_exit(queue, work, ret)                               \
 	SEGGER_SYSVIEW_RecordEndCallU32(TID_WORK_SUBMIT_TO_QUEUE, (uint32_t)ret)
 
+#define sys_port_trace_k_work_submit_batch_enter(queue, works, num_works)
+#define sys_port_trace_k_work_submit_batch_exit(queue, works, num_works, ret)
+#define sys_port_trace_k_work_pool_submit_enter(pool, work)
+#define sys_port_trace_k_work_pool_submit_exit(pool, work, ret)
+
 #define sys_port_trace_k_work_submit_enter(work)                                                   \
 	SEGGER_SYSVIEW_RecordU32(TID_WORK_SUBMIT, (uint32_t)(uintptr_t)work)
 
@@ -499,6 +504,12 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)
 #define sys_port_trace_k_msgq_get_blocking(msgq, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
 
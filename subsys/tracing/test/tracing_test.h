@@ -67,6 +67,10 @@
 #define sys_port_trace_k_work_init(work)
 #define sys_port_trace_k_work_submit_to_queue_enter(queue, work)
 #define sys_port_trace_k_work_submit_to_queue_exit(queue, work, ret)
+#define sys_port_trace_k_work_submit_batch_enter(queue, works, num_works)
+#define sys_port_trace_k_work_submit_batch_exit(queue, works, num_works, ret)
+#define sys_port_trace_k_work_pool_submit_enter(pool, work)
+#define sys_port_trace_k_work_pool_submit_exit(pool, work, ret)
 #define sys_port_trace_k_work_submit_enter(work)
 #define sys_port_trace_k_work_submit_exit(work, ret)
 #define sys_port_trace_k_work_flush_enter(work)
@@ -315,6 +319,18 @@
 	sys_trace_k_msgq_get_blocking(msgq, data, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)                                         \
 	sys_trace_k_msgq_get_exit(msgq, data, timeout, ret)
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)                                        \
+	sys_trace_k_msgq_put_many_enter(msgq, data, timeout)
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)                                     \
+	sys_trace_k_msgq_put_many_blocking(msgq, data, timeout)
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)                                    \
+	sys_trace_k_msgq_put_many_exit(msgq, data, timeout, ret)
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)                                        \
+	sys_trace_k_msgq_get_many_enter(msgq, data, timeout)
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)                                     \
+	sys_trace_k_msgq_get_many_blocking(msgq, data, timeout)
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)                                    \
+	sys_trace_k_msgq_get_many_exit(msgq, data, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret) sys_trace_k_msgq_peek(msgq, data, ret)
 #define sys_port_trace_k_msgq_purge(msgq) sys_trace_k_msgq_purge(msgq)
 
@@ -651,6 +667,14 @@ void sys_trace_k_msgq_put_exit(struct k_msgq *msgq, const void *data, k_timeout_
 void sys_trace_k_msgq_get_enter(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 void sys_trace_k_msgq_get_blocking(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 void sys_trace_k_msgq_get_exit(struct k_msgq *msgq, const void *data, k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_put_many_enter(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
+void sys_trace_k_msgq_put_many_blocking(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
+void sys_trace_k_msgq_put_many_exit(struct k_msgq *msgq, const void *data,
+				    k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_get_many_enter(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
+void sys_trace_k_msgq_get_many_blocking(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
+void sys_trace_k_msgq_get_many_exit(struct k_msgq *msgq, const void *data,
+				    k_timeout_t timeout, int ret);
 void sys_trace_k_msgq_peek(struct k_msgq *msgq, void *data, int ret);
 void sys_trace_k_msgq_purge(struct k_msgq *msgq);
 
@@ -87,6 +87,10 @@ void sys_trace_idle(void);
 #define sys_port_trace_k_work_init(work)
 #define sys_port_trace_k_work_submit_to_queue_enter(queue, work)
 #define sys_port_trace_k_work_submit_to_queue_exit(queue, work, ret)
+#define sys_port_trace_k_work_submit_batch_enter(queue, works, num_works)
+#define sys_port_trace_k_work_submit_batch_exit(queue, works, num_works, ret)
+#define sys_port_trace_k_work_pool_submit_enter(pool, work)
+#define sys_port_trace_k_work_pool_submit_exit(pool, work, ret)
 #define sys_port_trace_k_work_submit_enter(work)
 #define sys_port_trace_k_work_submit_exit(work, ret)
 #define sys_port_trace_k_work_flush_enter(work)
@@ -249,6 +253,12 @@ void sys_trace_idle(void);
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)
 #define sys_port_trace_k_msgq_get_blocking(msgq, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
 
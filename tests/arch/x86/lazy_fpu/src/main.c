@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* FP/SSE state of threads preempted by a fast timer interrupt.
+ *
+ * Fresh threads, which start without the FP/SSE unit under the lazy
+ * policy, first touch SSE while the other threads time slice with them
+ * and a timer fires every tick. Each holds its own values in XMM0-XMM7
+ * across many preemptions and checks them. A thread that never uses
+ * SSE must neither trap nor have its FP/SSE state saved.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/atomic.h>
+
+#define NUM_THREADS 4
+#define NUM_ROUNDS 3
+#define NUM_ITERATIONS 200
+#define SPINS 20000
+#define STACK_SIZE 1024
+#define PRIO K_PRIO_PREEMPT(1)
+
+#define XMM_REGS 8
+#define XMM_WORDS (XMM_REGS * 2)
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS + 1, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS + 1];
+
+static atomic_t mismatches;
+static atomic_t timer_ticks;
+static atomic_t release_int_thread;
+
+static void tick(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	atomic_inc(&timer_ticks);
+}
+
+static K_TIMER_DEFINE(tick_timer, tick, NULL);
+
+/* Load XMM0-XMM7, spin so the thread gets preempted with the values
+ * live, then store them. Nothing in between may touch XMM registers,
+ * so it is all one asm block.
+ */
+static void xmm_hold(const uint64_t *in, uint64_t *out, unsigned long spins)
+{
+	__asm__ volatile("movdqu 0(%1), %%xmm0\n\t"
+			 "movdqu 16(%1), %%xmm1\n\t"
+			 "movdqu 32(%1), %%xmm2\n\t"
+			 "movdqu 48(%1), %%xmm3\n\t"
+			 "movdqu 64(%1), %%xmm4\n\t"
+			 "movdqu 80(%1), %%xmm5\n\t"
+			 "movdqu 96(%1), %%xmm6\n\t"
+			 "movdqu 112(%1), %%xmm7\n\t"
+			 "1: pause\n\t"
+			 "dec %0\n\t"
+			 "jnz 1b\n\t"
+			 "movdqu %%xmm0, 0(%2)\n\t"
+			 "movdqu %%xmm1, 16(%2)\n\t"
+			 "movdqu %%xmm2, 32(%2)\n\t"
+			 "movdqu %%xmm3, 48(%2)\n\t"
+			 "movdqu %%xmm4, 64(%2)\n\t"
+			 "movdqu %%xmm5, 80(%2)\n\t"
+			 "movdqu %%xmm6, 96(%2)\n\t"
+			 "movdqu %%xmm7, 112(%2)\n\t"
+			 : "+r"(spins)
+			 : "r"(in), "r"(out)
+			 : "memory", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+			   "xmm5", "xmm6", "xmm7");
+}
+
+/* Integer only spin */
+static void int_spin(unsigned long spins)
+{
+	__asm__ volatile("1: pause\n\t"
+			 "dec %0\n\t"
+			 "jnz 1b\n\t"
+			 : "+r"(spins));
+}
+
+static void sse_thread(void *p1, void *p2, void *p3)
+{
+	uintptr_t id = (uintptr_t)p1;
+	uint64_t in[XMM_WORDS];
+	uint64_t out[XMM_WORDS];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Stagger the first SSE instruction of the threads */
+	int_spin(SPINS * (id + 1));
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		for (int w = 0; w < XMM_WORDS; w++) {
+			in[w] = ((uint64_t)id << 56) | ((uint64_t)i << 16) | w;
+		}
+
+		xmm_hold(in, out, SPINS);
+
+		for (int w = 0; w < XMM_WORDS; w++) {
+			if (in[w] != out[w]) {
+				atomic_inc(&mismatches);
+				break;
+			}
+		}
+	}
+}
+
+static void int_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!atomic_get(&release_int_thread)) {
+		int_spin(SPINS);
+	}
+}
+
+ZTEST(fpu_switch, test_first_use_under_interrupts)
+{
+	k_thread_runtime_stats_t stats;
+	struct k_thread *int_tid = &threads[NUM_THREADS];
+
+	/* Time slice with the workers */
+	k_thread_priority_set(k_current_get(), PRIO);
+
+	atomic_set(&release_int_thread, 0);
+	k_thread_create(int_tid, stacks[NUM_THREADS], STACK_SIZE, int_thread,
+			NULL, NULL, NULL, PRIO, 0, K_NO_WAIT);
+
+	k_timer_start(&tick_timer, K_TICKS(1), K_TICKS(1));
+
+	for (int round = 0; round < NUM_ROUNDS; round++) {
+		for (uintptr_t i = 0; i < NUM_THREADS; i++) {
+			k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+					sse_thread, (void *)i, NULL, NULL, PRIO, 0,
+					K_NO_WAIT);
+		}
+
+		for (int i = 0; i < NUM_THREADS; i++) {
+			zassert_ok(k_thread_join(&threads[i], K_FOREVER));
+
+			k_thread_runtime_stats_get(&threads[i], &stats);
+			if (IS_ENABLED(CONFIG_X86_LAZY_FPU_SWITCH)) {
+				zassert_equal(stats.fp_traps, 1U,
+					      "thread %d trapped %u times", i,
+					      stats.fp_traps);
+			} else {
+				zassert_equal(stats.fp_traps, 0U);
+			}
+		}
+	}
+
+	k_timer_stop(&tick_timer);
+
+	zassert_equal(atomic_get(&mismatches), 0, "XMM state corrupted");
+	zassert_true(atomic_get(&timer_ticks) > 0, "timer did not fire");
+
+	/* Preempted all along, but never an FP user */
+	k_thread_runtime_stats_get(int_tid, &stats);
+	if (IS_ENABLED(CONFIG_X86_LAZY_FPU_SWITCH)) {
+		zassert_equal(stats.fp_traps, 0U, "integer thread trapped");
+		zassert_equal(stats.fp_saves, 0U, "integer thread FP state saved");
+	}
+
+	atomic_set(&release_int_thread, 1);
+	zassert_ok(k_thread_join(int_tid, K_FOREVER));
+}
+
+ZTEST_SUITE(fpu_switch, NULL, NULL, NULL, NULL, NULL);
@@ -10,6 +10,46 @@
 
 #ifdef FIFO_BENCH
 
+static char batch_bench[NR_OF_FIFO_BATCH_MSGS * 4];
+
+/**
+ *
+ * @brief Batched queue transfer speed test
+ *
+ * Moves the same number of 4 byte messages through the queue in batches
+ * of @a batch and reports the average cost per message.
+ */
+static void queue_batch_test(uint32_t batch)
+{
+	uint32_t et; /* elapsed time */
+	char label[66];
+	int i;
+
+	et = BENCH_START();
+	for (i = 0; i < NR_OF_FIFO_BATCH_MSGS; i += batch) {
+		k_msgq_put_many(&DEMOQX4, &batch_bench[i * 4], batch, K_FOREVER);
+	}
+	et = TIME_STAMP_DELTA_GET(et);
+	check_result();
+
+	snprintf(label, sizeof(label),
+		 "enqueue 4 bytes msg in FIFO, batches of %u", batch);
+	PRINT_F(FORMAT, label,
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_BATCH_MSGS));
+
+	et = BENCH_START();
+	for (i = 0; i < NR_OF_FIFO_BATCH_MSGS; i += batch) {
+		k_msgq_get_many(&DEMOQX4, &batch_bench[i * 4], batch, K_FOREVER);
+	}
+	et = TIME_STAMP_DELTA_GET(et);
+	check_result();
+
+	snprintf(label, sizeof(label),
+		 "dequeue 4 bytes msg in FIFO, batches of %u", batch);
+	PRINT_F(FORMAT, label,
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_BATCH_MSGS));
+}
+
 /**
  *
  * @brief Queue transfer speed test
@@ -83,6 +123,10 @@ void queue_test(void)
 	PRINT_F(FORMAT,
 		"enqueue 4 bytes in FIFO to a waiting higher priority task",
 		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_RUNS));
+
+	queue_batch_test(1);
+	queue_batch_test(8);
+	queue_batch_test(64);
 }
 
 #endif /* FIFO_BENCH */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/printk.h>
+
+/* CRC throughput benchmark.  Every algorithm is run over blocks of
+ * each size, from the start of one pseudo-random buffer, until at least
+ * BYTES_PER_RUN bytes have been processed, and the result is reported
+ * in MB/s (10^6 bytes per second).  The final CRC of each run is
+ * printed as well, so different implementations can be checked for
+ * identical results.
+ */
+
+#define MAX_BLOCK 4096
+#define BYTES_PER_RUN (256 * 1024)
+
+static uint8_t buf[MAX_BLOCK];
+
+static uint32_t run_crc32_ieee(const uint8_t *data, size_t len)
+{
+	return crc32_ieee(data, len);
+}
+
+static uint32_t run_crc32_c(const uint8_t *data, size_t len)
+{
+	return crc32_c(0, data, len, true, true);
+}
+
+static uint32_t run_crc16_ccitt(const uint8_t *data, size_t len)
+{
+	return crc16_ccitt(0xffff, data, len);
+}
+
+static uint32_t run_crc16_itu_t(const uint8_t *data, size_t len)
+{
+	return crc16_itu_t(0xffff, data, len);
+}
+
+static uint32_t run_crc8_ccitt(const uint8_t *data, size_t len)
+{
+	return crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, data, len);
+}
+
+static const struct {
+	const char *name;
+	uint32_t (*fn)(const uint8_t *data, size_t len);
+} algos[] = {
+	{ "crc32_ieee", run_crc32_ieee },
+	{ "crc32_c", run_crc32_c },
+	{ "crc16_ccitt", run_crc16_ccitt },
+	{ "crc16_itu_t", run_crc16_itu_t },
+	{ "crc8_ccitt", run_crc8_ccitt },
+};
+
+static const size_t block_sizes[] = { 16, 64, 256, 1024, MAX_BLOCK };
+
+/* Simple LCG so every implementation sees the same data */
+static uint32_t next_rand(uint32_t *state)
+{
+	*state = *state * 1103515245U + 12345U;
+	return *state >> 8;
+}
+
+int main(void)
+{
+	uint32_t seed = 42U;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)next_rand(&seed);
+	}
+
+	printk("%-12s %5s %15s %10s\n", "algorithm", "block", "throughput",
+	       "crc");
+
+	for (int a = 0; a < ARRAY_SIZE(algos); a++) {
+		for (int b = 0; b < ARRAY_SIZE(block_sizes); b++) {
+			size_t len = block_sizes[b];
+			uint32_t iterations = BYTES_PER_RUN / len;
+			uint32_t result = 0U;
+			uint32_t start, cycles;
+			uint64_t kbps;
+
+			start = k_cycle_get_32();
+			for (uint32_t i = 0; i < iterations; i++) {
+				result = algos[a].fn(buf, len);
+			}
+			cycles = MAX(k_cycle_get_32() - start, 1U);
+
+			/* Thousands of bytes per second */
+			kbps = ((uint64_t)iterations * len *
+				sys_clock_hw_cycles_per_sec()) /
+			       ((uint64_t)cycles * 1000U);
+
+			printk("%-12s %5u %6u.%03u MB/s 0x%08x\n",
+			       algos[a].name, (uint32_t)len,
+			       (uint32_t)(kbps / 1000U),
+			       (uint32_t)(kbps % 1000U), result);
+		}
+	}
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/bitarray.h>
+
+#include "perf_rand.h"
+
+#define NUM_BITS 16384
+#define MAX_RUN 16
+#define NUM_ALLOCS 200
+
+SYS_BITARRAY_DEFINE_STATIC(ba, NUM_BITS);
+
+static const size_t alloc_sizes[] = { 1, 4, 32 };
+
+static uint32_t next_rand(uint64_t *state)
+{
+	return (uint32_t)(perf_rand(state) >> 32);
+}
+
+/* Allocate runs of 1..MAX_RUN bits at random places until pct percent
+ * of the bit array is allocated.  The seed is fixed, so builds with and
+ * without the summary bitmap are timed against the same layout.
+ */
+static void fill(unsigned int pct)
+{
+	size_t target = (size_t)NUM_BITS * pct / 100U;
+	size_t used = 0;
+	uint64_t seed = 42U;
+
+	zassert_equal(sys_bitarray_clear_region(&ba, NUM_BITS, 0), 0);
+
+	while (used < target) {
+		size_t len = MIN(1U + next_rand(&seed) % MAX_RUN, target - used);
+		size_t offset = next_rand(&seed) % (NUM_BITS - len + 1U);
+
+		if (sys_bitarray_test_and_set_region(&ba, len, offset,
+						     true) == 0) {
+			used += len;
+		}
+	}
+}
+
+/* Average cycles of sys_bitarray_alloc() for num_bits, freeing each
+ * allocation again untimed so the layout stays the same.  If there is
+ * no free run long enough this is the cost of a failed search.
+ */
+static uint32_t measure(size_t num_bits, bool *fit)
+{
+	uint64_t total = 0U;
+	size_t offset;
+
+	for (int i = 0; i < NUM_ALLOCS; i++) {
+		uint32_t start = k_cycle_get_32();
+		int ret = sys_bitarray_alloc(&ba, num_bits, &offset);
+
+		total += k_cycle_get_32() - start;
+
+		*fit = (ret == 0);
+		if (*fit) {
+			zassert_equal(sys_bitarray_free(&ba, num_bits, offset), 0);
+		} else {
+			zassert_equal(ret, -ENOSPC, "alloc of %zu bits failed",
+				      num_bits);
+		}
+	}
+
+	return (uint32_t)(total / NUM_ALLOCS);
+}
+
+/**
+ * @brief Measure sys_bitarray_alloc() at increasing occupancy
+ *
+ * @details A 16384 bit array is filled to 10%, 50% and 90% with
+ * randomly placed runs of up to 16 bits, and the average time to
+ * allocate 1, 4 and 32 bits is reported for each.  At 90% there is no
+ * free run of 32 bits, which measures a search of the whole array.
+ *
+ * @ingroup lib_bitarray_tests
+ */
+ZTEST(bitarray_perf, test_bitarray_alloc_occupancy)
+{
+	static const unsigned int occupancy[] = { 10, 50, 90 };
+
+	TC_PRINT("%s summary bitmap\n",
+		 IS_ENABLED(CONFIG_SYS_BITARRAY_SUMMARY) ? "with" : "without");
+
+	for (int o = 0; o < ARRAY_SIZE(occupancy); o++) {
+		fill(occupancy[o]);
+
+		for (int s = 0; s < ARRAY_SIZE(alloc_sizes); s++) {
+			bool fit;
+			uint32_t cycles = measure(alloc_sizes[s], &fit);
+
+			TC_PRINT("occupancy %2u%% alloc %2zu bits: %6u cycles%s\n",
+				 occupancy[o], alloc_sizes[s], cycles,
+				 fit ? "" : " (no fit)");
+		}
+	}
+}
+
+ZTEST_SUITE(bitarray_perf, NULL, NULL, NULL, NULL, NULL);
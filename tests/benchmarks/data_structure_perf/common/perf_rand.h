@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_TESTS_BENCHMARKS_DATA_STRUCTURE_PERF_COMMON_PERF_RAND_H_
+#define ZEPHYR_TESTS_BENCHMARKS_DATA_STRUCTURE_PERF_COMMON_PERF_RAND_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Next value of a 64-bit linear congruential generator
+ *
+ * Deterministic input for the data structure benchmarks: the same seed
+ * always yields the same sequence, so results stay comparable between
+ * runs and configurations.  The period is 2^64, so no value repeats
+ * within a run.  The low bits are weak, use the high ones to draw small
+ * numbers.
+ *
+ * @param state generator state, initialized with the seed
+ *
+ * @return the new state
+ */
+static inline uint64_t perf_rand(uint64_t *state)
+{
+	*state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return *state;
+}
+
+#endif /* ZEPHYR_TESTS_BENCHMARKS_DATA_STRUCTURE_PERF_COMMON_PERF_RAND_H_ */
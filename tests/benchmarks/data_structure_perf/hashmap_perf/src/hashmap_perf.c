@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#include "perf_rand.h"
+
+#define MAX_ENTRIES 1024
+
+SYS_HASHMAP_SC_DEFINE_STATIC(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(oa_lp_map);
+SYS_HASHMAP_OA_RH_DEFINE_STATIC(oa_rh_map);
+SYS_HASHMAP_OA_RH_DEFINE_STATIC_ADVANCED(oa_rh_high_map, sys_hash32,
+					 SYS_HASHMAP_DEFAULT_ALLOCATOR,
+					 SYS_HASHMAP_CONFIG(SIZE_MAX,
+							    SYS_HASHMAP_OA_RH_HIGH_LOAD_FACTOR));
+
+static const struct {
+	const char *name;
+	struct sys_hashmap *map;
+} maps[] = {
+	{ "separate chaining (75%)", &sc_map },
+	{ "linear probe      (75%)", &oa_lp_map },
+	{ "robin hood        (75%)", &oa_rh_map },
+	{ "robin hood        (90%)", &oa_rh_high_map },
+};
+
+static const size_t sizes[] = { 64, 256, MAX_ENTRIES };
+
+enum op {
+	OP_INSERT,
+	OP_GET,
+	OP_MISS,
+	OP_REMOVE,
+};
+
+/* Keys present in the map, followed by as many keys that are not */
+static uint64_t keys[2 * MAX_ENTRIES];
+
+/* The same keys are used for every backend.  perf_rand() does not
+ * repeat within its period, so the second half never hits the map.
+ */
+static void make_keys(void)
+{
+	uint64_t seed = 42U;
+
+	for (int i = 0; i < ARRAY_SIZE(keys); i++) {
+		keys[i] = perf_rand(&seed);
+	}
+}
+
+/* Average cycles per operation over keys[first .. first + n - 1] */
+static uint32_t measure(struct sys_hashmap *map, size_t first, size_t n,
+			enum op op)
+{
+	uint32_t start;
+	uint64_t total = 0U;
+	uint64_t value;
+
+	for (size_t i = first; i < first + n; i++) {
+		start = k_cycle_get_32();
+
+		switch (op) {
+		case OP_INSERT:
+			zassert_equal(sys_hashmap_insert(map, keys[i], i, NULL), 1);
+			break;
+		case OP_GET:
+			zassert_true(sys_hashmap_get(map, keys[i], &value));
+			break;
+		case OP_MISS:
+			zassert_false(sys_hashmap_get(map, keys[i], &value));
+			break;
+		case OP_REMOVE:
+			zassert_true(sys_hashmap_remove(map, keys[i], &value));
+			break;
+		}
+
+		total += k_cycle_get_32() - start;
+	}
+
+	return (uint32_t)(total / n);
+}
+
+/**
+ * @brief Compare hashmap backends at increasing sizes
+ *
+ * @details For each backend and for 64, 256 and 1024 entries, report the
+ * average time to insert every key, look up every key, look up the same
+ * number of absent keys and finally remove every key.  The Robin Hood
+ * map is run both at the default load factor and at 90%.
+ */
+ZTEST(hashmap_perf, test_hashmap_backends)
+{
+	make_keys();
+
+	for (int m = 0; m < ARRAY_SIZE(maps); m++) {
+		struct sys_hashmap *map = maps[m].map;
+
+		for (int s = 0; s < ARRAY_SIZE(sizes); s++) {
+			size_t n = sizes[s];
+			uint32_t insert, get, miss, remove;
+
+			insert = measure(map, 0, n, OP_INSERT);
+			get = measure(map, 0, n, OP_GET);
+			miss = measure(map, MAX_ENTRIES, n, OP_MISS);
+			remove = measure(map, 0, n, OP_REMOVE);
+
+			zassert_true(sys_hashmap_is_empty(map));
+
+			TC_PRINT("%s %4zu entries: insert %5u get %5u miss %5u remove %5u cycles\n",
+				 maps[m].name, n, insert, get, miss, remove);
+		}
+
+		sys_hashmap_clear(map, NULL, NULL);
+	}
+}
+
+ZTEST_SUITE(hashmap_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure ISR to thread switch cost with and without FP users
+ *
+ * A thread repeatedly raises a software interrupt whose handler wakes a
+ * higher priority thread, so every iteration preempts the first thread
+ * and switches to the second one on interrupt exit. This is run once
+ * with threads that never touch floating point registers and once with
+ * threads that do, to show what preserving FP/SIMD state costs.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+
+#include "utils.h"
+
+#define N_SWITCHES 1000
+#define FP_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING)
+#define FP_OPTIONS K_FP_REGS
+#else
+#define FP_OPTIONS 0
+#endif
+
+static K_THREAD_STACK_DEFINE(fp_int_stack, FP_STACK_SIZE);
+static K_THREAD_STACK_DEFINE(fp_wake_stack, FP_STACK_SIZE);
+static struct k_thread fp_int_thread;
+static struct k_thread fp_wake_thread;
+
+static K_SEM_DEFINE(fp_sem, 0, 1);
+
+static timing_t timestamp_start;
+static uint64_t fp_total;
+static volatile double fp_acc;
+
+static void fp_touch(bool use_fp)
+{
+	if (use_fp) {
+		fp_acc = fp_acc * 0.5 + 1.0;
+	}
+}
+
+static void fp_isr(const void *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_sem_give(&fp_sem);
+	timestamp_start = timing_counter_get();
+}
+
+/* Lower priority: gets preempted by fp_isr() */
+static void fp_int_entry(void *p1, void *p2, void *p3)
+{
+	bool use_fp = (bool)POINTER_TO_UINT(p1);
+
+	for (int i = 0; i < N_SWITCHES; i++) {
+		fp_touch(use_fp);
+		irq_offload(fp_isr, NULL);
+	}
+}
+
+/* Higher priority: runs as soon as fp_isr() returns */
+static void fp_wake_entry(void *p1, void *p2, void *p3)
+{
+	bool use_fp = (bool)POINTER_TO_UINT(p1);
+	timing_t timestamp_end;
+
+	for (int i = 0; i < N_SWITCHES; i++) {
+		k_sem_take(&fp_sem, K_FOREVER);
+		timestamp_end = timing_counter_get();
+		fp_total += timing_cycles_get(&timestamp_start, &timestamp_end);
+		fp_touch(use_fp);
+	}
+}
+
+static void fp_print_usage(const char *name, struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_THREAD_USAGE_FPU
+	k_thread_runtime_stats_t stats;
+
+	k_thread_runtime_stats_get(thread, &stats);
+	printk("  %s thread: %u FP saves, %u FP traps\n",
+	       name, stats.fp_saves, stats.fp_traps);
+#else
+	ARG_UNUSED(name);
+	ARG_UNUSED(thread);
+#endif
+}
+
+static void fp_ctx_switch_run(bool use_fp)
+{
+	uint32_t options = use_fp ? FP_OPTIONS : 0;
+
+	fp_total = 0U;
+
+	timing_start();
+	TICK_SYNCH();
+
+	/* The waker blocks at once, the interrupter preempts us */
+	k_thread_create(&fp_wake_thread, fp_wake_stack,
+			K_THREAD_STACK_SIZEOF(fp_wake_stack), fp_wake_entry,
+			UINT_TO_POINTER(use_fp), NULL, NULL,
+			K_PRIO_PREEMPT(8), options, K_NO_WAIT);
+	k_thread_create(&fp_int_thread, fp_int_stack,
+			K_THREAD_STACK_SIZEOF(fp_int_stack), fp_int_entry,
+			UINT_TO_POINTER(use_fp), NULL, NULL,
+			K_PRIO_PREEMPT(9), options, K_NO_WAIT);
+
+	k_thread_join(&fp_int_thread, K_FOREVER);
+	k_thread_join(&fp_wake_thread, K_FOREVER);
+
+	timing_stop();
+
+	PRINT_STATS_AVG(use_fp ? "Switch from ISR to other thread, FP users" :
+				 "Switch from ISR to other thread, no FP",
+			(uint32_t)fp_total, N_SWITCHES, false, "");
+
+	fp_print_usage("preempted", &fp_int_thread);
+	fp_print_usage("woken", &fp_wake_thread);
+}
+
+/**
+ *
+ * @brief The test main function
+ *
+ * @return 0 on success
+ */
+int fpu_ctx_switch(void)
+{
+	fp_ctx_switch_run(false);
+	fp_ctx_switch_run(true);
+
+	return 0;
+}
@@ -11,7 +11,25 @@
 #define TEST_COUNT 100
 #define TEST_SIZE 10
 
-void heap_malloc_free(void)
+/* Larger than any fast bin, always served by the bucket allocator */
+#define TEST_SIZE_SLOW 256
+
+/* Fragmentation workload: random small alloc/free churn */
+#define FRAG_HEAP_SIZE 4096
+#define FRAG_SLOTS 32
+#define FRAG_ITERATIONS 2000
+
+K_HEAP_DEFINE(frag_heap, FRAG_HEAP_SIZE);
+
+/* Simple LCG so every heap configuration sees the same sequence */
+static uint32_t next_rand(uint32_t *state)
+{
+	*state = *state * 1103515245U + 12345U;
+	return *state >> 8;
+}
+
+static void heap_malloc_free_size(const char *malloc_label,
+				  const char *free_label, size_t size)
 {
 	timing_t heap_malloc_start_time = 0U;
 	timing_t heap_malloc_end_time = 0U;
@@ -27,11 +45,9 @@ void heap_malloc_free(void)
 	char  error_string[80];
 	const char *notes = "";
 
-	timing_start();
-
 	while (count != TEST_COUNT) {
 		heap_malloc_start_time = timing_counter_get();
-		void *allocated_mem = k_malloc(TEST_SIZE);
+		void *allocated_mem = k_malloc(size);
 
 		heap_malloc_end_time = timing_counter_get();
 		if (allocated_mem == NULL) {
@@ -63,10 +79,75 @@ void heap_malloc_free(void)
 		notes = "Memory heap too small--increase it.";
 	}
 
-	PRINT_STATS_AVG("Average time for heap malloc", sum_malloc, count,
-			failed, notes);
-	PRINT_STATS_AVG("Average time for heap free", sum_free, count,
-			failed, notes);
+	PRINT_STATS_AVG(malloc_label, sum_malloc, count, failed, notes);
+	PRINT_STATS_AVG(free_label, sum_free, count, failed, notes);
+}
+
+/*
+ * Pseudo-randomly allocate and free 16..128 byte blocks from a private heap
+ * and report how far into the heap allocations reached (high-water
+ * mark) compared to the peak number of bytes actually live.  The
+ * difference is memory lost to fragmentation.
+ */
+static void heap_fragmentation(void)
+{
+	void *slots[FRAG_SLOTS] = { NULL };
+	size_t sizes[FRAG_SLOTS];
+	uintptr_t base = (uintptr_t)frag_heap.heap.init_mem;
+	uintptr_t high_water = base;
+	size_t live = 0U, peak_live = 0U;
+	uint32_t failures = 0U;
+	uint32_t seed = 42U;
+
+	for (int i = 0; i < FRAG_ITERATIONS; i++) {
+		uint32_t r = next_rand(&seed);
+		int slot = r % FRAG_SLOTS;
+
+		if (slots[slot] != NULL) {
+			k_heap_free(&frag_heap, slots[slot]);
+			slots[slot] = NULL;
+			live -= sizes[slot];
+			continue;
+		}
+
+		sizes[slot] = 16U * (1U + ((r >> 8) % 8U));
+		slots[slot] = k_heap_alloc(&frag_heap, sizes[slot], K_NO_WAIT);
+		if (slots[slot] == NULL) {
+			failures++;
+			continue;
+		}
+
+		live += sizes[slot];
+		peak_live = MAX(peak_live, live);
+		high_water = MAX(high_water,
+				 (uintptr_t)slots[slot] + sizes[slot]);
+	}
+
+	for (int i = 0; i < FRAG_SLOTS; i++) {
+		if (slots[i] != NULL) {
+			k_heap_free(&frag_heap, slots[i]);
+		}
+	}
+
+	printk("Heap fragmentation: peak live %u bytes, high-water %u of %u bytes, "
+	       "%u failed allocations\n", (uint32_t)peak_live,
+	       (uint32_t)(high_water - base), FRAG_HEAP_SIZE, failures);
+}
+
+void heap_malloc_free(void)
+{
+	timing_start();
+
+	/* With CONFIG_SYS_HEAP_FAST_BINS, repeated small requests hit the
+	 * fast bins after the first iteration.
+	 */
+	heap_malloc_free_size("Average time for heap malloc",
+			      "Average time for heap free", TEST_SIZE);
+	heap_malloc_free_size("Average time for heap malloc (slow path)",
+			      "Average time for heap free (slow path)",
+			      TEST_SIZE_SLOW);
+
+	heap_fragmentation();
 
 	timing_stop();
 }
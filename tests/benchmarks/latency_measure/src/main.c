@@ -21,8 +21,10 @@ int error_count; /* track number of errors */
 extern void thread_switch_yield(void);
 extern void int_to_thread(void);
 extern void int_to_thread_evt(void);
+extern int fpu_ctx_switch(void);
 extern void sema_test_signal(void);
 extern void mutex_lock_unlock(void);
+extern int mutex_lock_contended(void);
 extern int coop_ctx_switch(void);
 extern int sema_test(void);
 extern int sema_context_switch(void);
@@ -42,6 +44,10 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 	TC_START("Time Measurement");
 	TC_PRINT("Timing results: Clock frequency: %u MHz\n", freq);
 
+#if CONFIG_MP_MAX_NUM_CPUS > 1
+	/* The other measurements assume a single CPU */
+	mutex_lock_contended();
+#else
 	thread_switch_yield();
 
 	coop_ctx_switch();
@@ -50,6 +56,8 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 
 	int_to_thread_evt();
 
+	fpu_ctx_switch();
+
 	suspend_resume();
 
 	sema_test_signal();
@@ -59,6 +67,7 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 	mutex_lock_unlock();
 
 	heap_malloc_free();
+#endif
 
 	TC_END_REPORT(error_count);
 }
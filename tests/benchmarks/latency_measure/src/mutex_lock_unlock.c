@@ -77,3 +77,91 @@ int mutex_lock_unlock(void)
 	timing_stop();
 	return 0;
 }
+
+#if CONFIG_MP_MAX_NUM_CPUS > 1
+
+/* the number of contended mutex acquisitions measured */
+#define N_TEST_CONTENDED 1000
+
+/* cycles spent inside and between critical sections */
+#define HOLD_CYCLES 500
+
+#define CONTENDER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_MUTEX_DEFINE(contended_mutex);
+static K_THREAD_STACK_DEFINE(contender_stack, CONTENDER_STACK_SIZE);
+static struct k_thread contender_thread;
+static volatile bool contender_stop;
+
+static void busy_cycles(uint32_t cycles)
+{
+	uint32_t start = k_cycle_get_32();
+
+	while ((k_cycle_get_32() - start) < cycles) {
+	}
+}
+
+static void contender(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!contender_stop) {
+		k_mutex_lock(&contended_mutex, K_FOREVER);
+		busy_cycles(HOLD_CYCLES);
+		k_mutex_unlock(&contended_mutex);
+		busy_cycles(HOLD_CYCLES);
+	}
+}
+
+/**
+ *
+ * @brief Test for the contended mutex handoff time
+ *
+ * A second thread, running on another CPU, repeatedly holds the mutex
+ * for a short critical section.  The routine measures how long it takes
+ * to get the mutex while competing with it, which includes waiting for
+ * the other thread to release it.  With CONFIG_MUTEX_ADAPTIVE_SPIN the
+ * wait is a bounded spin, otherwise a pend and a wakeup.
+ *
+ * @return 0 on success
+ */
+int mutex_lock_contended(void)
+{
+	uint64_t sum = 0U;
+	timing_t timestamp_start;
+	timing_t timestamp_end;
+	const char *notes = IS_ENABLED(CONFIG_MUTEX_ADAPTIVE_SPIN) ?
+			    "adaptive spin" : "no spin";
+
+	timing_start();
+
+	contender_stop = false;
+	k_thread_create(&contender_thread, contender_stack,
+			CONTENDER_STACK_SIZE, contender, NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	for (int i = 0; i < N_TEST_CONTENDED; i++) {
+		timestamp_start = timing_counter_get();
+		k_mutex_lock(&contended_mutex, K_FOREVER);
+		timestamp_end = timing_counter_get();
+
+		busy_cycles(HOLD_CYCLES);
+		k_mutex_unlock(&contended_mutex);
+		busy_cycles(HOLD_CYCLES);
+
+		sum += timing_cycles_get(&timestamp_start, &timestamp_end);
+	}
+
+	contender_stop = true;
+	k_thread_join(&contender_thread, K_FOREVER);
+
+	PRINT_STATS_AVG("Average time to lock a contended mutex",
+			(uint32_t)sum, N_TEST_CONTENDED, false, notes);
+
+	timing_stop();
+	return 0;
+}
+
+#endif /* CONFIG_MP_MAX_NUM_CPUS > 1 */
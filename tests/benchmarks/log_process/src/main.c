@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+
+LOG_MODULE_REGISTER(bench, LOG_LEVEL_INF);
+
+/* Enough messages to keep the processing thread busy, few enough that
+ * they all fit in the log buffer without drops.
+ */
+#define N_MSGS 256
+#define N_ROUNDS 10
+
+static K_SEM_DEFINE(done, 0, 1);
+static volatile uint32_t processed;
+static volatile uint32_t dropped;
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+	ARG_UNUSED(msg);
+
+	if (++processed == N_MSGS) {
+		k_sem_give(&done);
+	}
+}
+
+static void drop(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	dropped += cnt;
+}
+
+static void panic(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api null_backend_api = {
+	.process = process,
+	.dropped = drop,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(null_backend, null_backend_api, true);
+
+int main(void)
+{
+	uint64_t total = 0U;
+
+	/* Let the processing thread start and activate the backend */
+	k_msleep(100);
+
+	for (int r = 0; r < N_ROUNDS; r++) {
+		processed = 0U;
+
+		for (int i = 0; i < N_MSGS; i++) {
+			LOG_INF("message %d", i);
+		}
+
+		uint32_t start = k_cycle_get_32();
+
+		k_sem_take(&done, K_FOREVER);
+		total += k_cycle_get_32() - start;
+	}
+
+	printk("batch %2d: %8u messages/s, %u cycles/message, %u dropped\n",
+	       CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE,
+	       (uint32_t)((uint64_t)N_MSGS * N_ROUNDS *
+			  sys_clock_hw_cycles_per_sec() / total),
+	       (uint32_t)(total / (N_MSGS * N_ROUNDS)), dropped);
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+
+#include "ipv4.h"
+#include "udp_internal.h"
+
+/* Connection lookup benchmark.  UDP packets are received on a dummy
+ * interface with a growing number of UDP handlers registered, always
+ * for the handler registered first.
+ */
+
+#define N_RUNS 1000
+#define N_SETTLE 10
+#define BASE_PORT 10000
+#define PEER_PORT 4242
+
+static const int conn_counts[] = { 1, 10, 100, CONFIG_NET_MAX_CONN };
+
+static struct net_conn_handle *handles[CONFIG_NET_MAX_CONN];
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+static uint32_t delivered;
+
+static uint8_t mac_addr[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+static void bench_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr),
+			     NET_LINK_ETHERNET);
+}
+
+static int bench_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static struct dummy_api bench_if_api = {
+	.iface_api.init = bench_iface_init,
+	.send = bench_send,
+};
+
+NET_DEVICE_INIT(net_conn_bench, "net_conn_bench", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &bench_if_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static enum net_verdict bench_recv(struct net_conn *conn,
+				   struct net_pkt *pkt,
+				   union net_ip_header *ip_hdr,
+				   union net_proto_header *proto_hdr,
+				   void *user_data)
+{
+	delivered++;
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+
+static struct net_pkt *make_pkt(struct net_if *iface)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(iface, 0, AF_INET, IPPROTO_UDP,
+					K_SECONDS(1));
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	if (net_ipv4_create(pkt, &peer_addr, &my_addr) ||
+	    net_udp_create(pkt, htons(PEER_PORT), htons(BASE_PORT))) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_ipv4_finalize(pkt, IPPROTO_UDP);
+
+	return pkt;
+}
+
+static int bench(struct net_if *iface, int count)
+{
+	uint64_t total = 0U;
+	int ret;
+
+	for (int i = 0; i < count; i++) {
+		ret = net_udp_register(AF_INET, NULL, NULL, 0, BASE_PORT + i,
+				       NULL, bench_recv, NULL, &handles[i]);
+		if (ret < 0) {
+			printk("Cannot register handler %d: %d\n", i, ret);
+			return ret;
+		}
+	}
+
+	delivered = 0U;
+
+	for (int i = 0; i < N_RUNS + N_SETTLE; i++) {
+		struct net_pkt *pkt = make_pkt(iface);
+		uint32_t start;
+
+		if (pkt == NULL) {
+			printk("Cannot create packet\n");
+			return -ENOMEM;
+		}
+
+		start = k_cycle_get_32();
+		ret = net_recv_data(iface, pkt);
+		if (i >= N_SETTLE) {
+			total += k_cycle_get_32() - start;
+		}
+
+		if (ret < 0) {
+			printk("Cannot receive packet: %d\n", ret);
+			net_pkt_unref(pkt);
+			return ret;
+		}
+	}
+
+	for (int i = 0; i < count; i++) {
+		(void)net_udp_unregister(handles[i]);
+	}
+
+	if (delivered != N_RUNS + N_SETTLE) {
+		printk("Only %u of %u packets delivered\n", delivered,
+		       N_RUNS + N_SETTLE);
+		return -EIO;
+	}
+
+	printk("%5d connections: %6u cycles per packet\n", count,
+	       (uint32_t)(total / N_RUNS));
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+
+	if (net_if_ipv4_addr_add(iface, &my_addr, NET_ADDR_MANUAL, 0) == NULL) {
+		printk("Cannot add IPv4 address\n");
+		return 0;
+	}
+
+	printk("%d hash buckets\n", CONFIG_NET_CONN_HASH_SIZE);
+
+	for (int i = 0; i < ARRAY_SIZE(conn_counts); i++) {
+		if (bench(iface, conn_counts[i]) < 0) {
+			return 0;
+		}
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
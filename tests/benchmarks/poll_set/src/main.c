@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Poll set benchmark.  The main thread waits on N_EVENTS semaphores
+ * while a lower priority thread gives them in turn, so that exactly one
+ * event becomes ready per wakeup.  The time between two returns of the
+ * wait covers the whole event loop: finding the ready event, taking its
+ * semaphore, and the wait itself including the context switches.
+ */
+
+#define N_EVENTS 64
+#define N_RUNS 1000
+#define N_SETTLE 10
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_sem sems[N_EVENTS];
+static struct k_poll_event events[N_EVENTS];
+
+static struct k_thread giver_thread;
+static K_THREAD_STACK_DEFINE(giver_stack, STACK_SIZE);
+
+static void giver(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < N_RUNS + N_SETTLE + 1; i++) {
+		k_sem_give(&sems[i % N_EVENTS]);
+	}
+}
+
+static void start_giver(void)
+{
+	for (int i = 0; i < N_EVENTS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+	}
+
+	k_thread_create(&giver_thread, giver_stack, STACK_SIZE, giver,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+}
+
+static void report(const char *name, uint64_t total)
+{
+	printk("%-18s %d events: %6u cycles per wakeup\n", name, N_EVENTS,
+	       (uint32_t)(total / N_RUNS));
+}
+
+static void bench_poll(void)
+{
+	uint64_t total = 0U;
+	uint32_t last = 0U;
+
+	start_giver();
+
+	for (int i = 0; i < N_RUNS + N_SETTLE + 1; i++) {
+		int ready = -1;
+		int ret = k_poll(events, N_EVENTS, K_FOREVER);
+		uint32_t now = k_cycle_get_32();
+
+		if (ret != 0) {
+			printk("k_poll() failed: %d\n", ret);
+			return;
+		}
+
+		if (i > N_SETTLE) {
+			total += now - last;
+		}
+		last = now;
+
+		for (int j = 0; j < N_EVENTS; j++) {
+			if (events[j].state != K_POLL_STATE_NOT_READY) {
+				events[j].state = K_POLL_STATE_NOT_READY;
+				ready = j;
+			}
+		}
+
+		if ((ready < 0) || (k_sem_take(&sems[ready], K_NO_WAIT) != 0)) {
+			printk("k_poll() returned no ready event\n");
+			return;
+		}
+	}
+
+	k_thread_join(&giver_thread, K_FOREVER);
+	report("k_poll()", total);
+}
+
+static void bench_poll_set(void)
+{
+	struct k_poll_event *ready[1];
+	struct k_poll_set set;
+	uint64_t total = 0U;
+	uint32_t last = 0U;
+
+	start_giver();
+
+	k_poll_set_init(&set);
+	for (int i = 0; i < N_EVENTS; i++) {
+		(void)k_poll_set_add(&set, &events[i]);
+	}
+
+	for (int i = 0; i < N_RUNS + N_SETTLE + 1; i++) {
+		int ret = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+					  K_FOREVER);
+		uint32_t now = k_cycle_get_32();
+
+		if (ret != 1) {
+			printk("k_poll_set_wait() failed: %d\n", ret);
+			return;
+		}
+
+		if (i > N_SETTLE) {
+			total += now - last;
+		}
+		last = now;
+
+		if (k_sem_take(ready[0]->sem, K_NO_WAIT) != 0) {
+			printk("k_poll_set_wait() returned no ready event\n");
+			return;
+		}
+	}
+
+	for (int i = 0; i < N_EVENTS; i++) {
+		(void)k_poll_set_remove(&set, &events[i]);
+	}
+
+	k_thread_join(&giver_thread, K_FOREVER);
+	report("k_poll_set_wait()", total);
+}
+
+int main(void)
+{
+	bench_poll();
+	bench_poll_set();
+
+	printk("fin\n");
+
+	return 0;
+}
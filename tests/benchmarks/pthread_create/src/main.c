@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/posix/pthread.h>
+#include <zephyr/sys/printk.h>
+
+/* POSIX thread creation benchmark.  The main thread creates a thread
+ * with default attributes, so with a dynamically allocated stack, and
+ * joins it, N_RUNS times.  The thread does nothing, so the round trip
+ * is dominated by thread setup and teardown: stack allocation, thread
+ * initialization, the context switches and recycling on join.
+ */
+
+#define N_RUNS 1000
+#define N_SETTLE 10
+
+static void *thread_fn(void *arg)
+{
+	return arg;
+}
+
+int main(void)
+{
+	uint64_t create_total = 0U;
+	uint64_t total = 0U;
+
+	printk("stack cache %d, reuse stacks %s, pool %d\n",
+	       CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE,
+	       IS_ENABLED(CONFIG_PTHREAD_REUSE_STACKS) ? "y" : "n",
+	       CONFIG_DYNAMIC_THREAD_POOL_SIZE);
+
+	for (int i = 0; i < N_RUNS + N_SETTLE; i++) {
+		pthread_t th;
+		void *retval;
+		uint32_t start = k_cycle_get_32();
+		int ret = pthread_create(&th, NULL, thread_fn, UINT_TO_POINTER(i));
+		uint32_t created = k_cycle_get_32();
+
+		if (ret != 0) {
+			printk("pthread_create() failed: %d\n", ret);
+			return 0;
+		}
+
+		ret = pthread_join(th, &retval);
+
+		uint32_t joined = k_cycle_get_32();
+
+		if ((ret != 0) || (POINTER_TO_UINT(retval) != i)) {
+			printk("pthread_join() failed: %d\n", ret);
+			return 0;
+		}
+
+		if (i >= N_SETTLE) {
+			create_total += created - start;
+			total += joined - start;
+		}
+	}
+
+	printk("create %8u cycles, create + join %8u cycles (%u ns)\n",
+	       (uint32_t)(create_total / N_RUNS), (uint32_t)(total / N_RUNS),
+	       (uint32_t)k_cyc_to_ns_floor64(total / N_RUNS));
+
+	printk("fin\n");
+	return 0;
+}
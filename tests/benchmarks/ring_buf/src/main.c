@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#define BUF_SIZE 1024
+#define N_OPS 32
+#define N_ROUNDS 200
+
+RING_BUF_DECLARE(rb, BUF_SIZE);
+static struct k_spinlock lock;
+
+static uint8_t data[16];
+
+struct run {
+	uint32_t len;
+	bool locked;
+	uint64_t cycles;
+};
+
+static void isr_put(const void *arg)
+{
+	struct run *run = (struct run *)arg;
+	k_spinlock_key_t key;
+
+	for (int i = 0; i < N_OPS; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		if (run->locked) {
+			key = k_spin_lock(&lock);
+			(void)ring_buf_put(&rb, data, run->len);
+			k_spin_unlock(&lock, key);
+		} else {
+			(void)ring_buf_put(&rb, data, run->len);
+		}
+
+		run->cycles += k_cycle_get_32() - start;
+	}
+}
+
+static uint64_t thread_get(uint32_t len, bool locked)
+{
+	uint8_t out[16];
+	uint64_t cycles = 0U;
+	k_spinlock_key_t key;
+
+	for (int i = 0; i < N_OPS; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		if (locked) {
+			key = k_spin_lock(&lock);
+			(void)ring_buf_get(&rb, out, len);
+			k_spin_unlock(&lock, key);
+		} else {
+			(void)ring_buf_get(&rb, out, len);
+		}
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return cycles;
+}
+
+static void measure(uint32_t len, bool locked, uint32_t *put, uint32_t *get)
+{
+	struct run run = { .len = len, .locked = locked };
+	uint64_t get_cycles = 0U;
+
+	ring_buf_reset(&rb);
+
+	for (int r = 0; r < N_ROUNDS; r++) {
+		irq_offload(isr_put, &run);
+		get_cycles += thread_get(len, locked);
+		__ASSERT_NO_MSG(ring_buf_is_empty(&rb));
+	}
+
+	*put = (uint32_t)(run.cycles / (N_OPS * N_ROUNDS));
+	*get = (uint32_t)(get_cycles / (N_OPS * N_ROUNDS));
+}
+
+int main(void)
+{
+	static const uint32_t lens[] = { 1, 4, 16 };
+	const char *mode = IS_ENABLED(CONFIG_RING_BUFFER_SPSC) ? "spsc" : "plain";
+
+	for (int i = 0; i < ARRAY_SIZE(lens); i++) {
+		uint32_t put_locked, get_locked, put, get;
+
+		measure(lens[i], true, &put_locked, &get_locked);
+		measure(lens[i], false, &put, &get);
+
+		printk("isr put %2u bytes spinlock %5u %s %5u cycles\n",
+		       lens[i], put_locked, mode, put);
+		printk("get     %2u bytes spinlock %5u %s %5u cycles\n",
+		       lens[i], get_locked, mode, get);
+	}
+
+	printk("fin\n");
+	return 0;
+}
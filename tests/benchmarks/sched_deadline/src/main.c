@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Deadline miss rate of periodic tasks under overload, with plain EDF
+ * and with constant bandwidth servers.  Every task runs at the same
+ * priority and releases a job each period.  A job consumes a fixed
+ * amount of CPU time and misses its deadline if it completes after
+ * the next release.  One task consumes far more than its declared
+ * budget.
+ */
+
+#define RUN_MS 2000
+#define TASK_PRIO K_PRIO_PREEMPT(2)
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct task {
+	const char *name;
+	uint32_t period_ms;
+	uint32_t budget_ms;
+	uint32_t work_ms;
+	bool rogue;
+	uint32_t jobs;
+	uint32_t misses;
+};
+
+static struct task tasks[] = {
+	{ .name = "ctl_a", .period_ms = 10, .budget_ms = 2, .work_ms = 2 },
+	{ .name = "ctl_b", .period_ms = 20, .budget_ms = 4, .work_ms = 4 },
+	{ .name = "ctl_c", .period_ms = 40, .budget_ms = 8, .work_ms = 8 },
+	{ .name = "rogue", .period_ms = 20, .budget_ms = 4, .work_ms = 15,
+	  .rogue = true },
+};
+
+#define N_TASKS ARRAY_SIZE(tasks)
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, N_TASKS, STACK_SIZE);
+static struct k_thread threads[N_TASKS];
+
+static bool use_cbs;
+static int64_t start_tick;
+static int64_t stop_tick;
+
+/* Spin until the calling thread has run for this many more cycles */
+static void consume(uint32_t cycles)
+{
+	k_thread_runtime_stats_t stats;
+	uint64_t end;
+
+	k_thread_runtime_stats_get(k_current_get(), &stats);
+	end = stats.execution_cycles + cycles;
+
+	do {
+		k_thread_runtime_stats_get(k_current_get(), &stats);
+	} while (stats.execution_cycles < end);
+}
+
+static void task_entry(void *p1, void *p2, void *p3)
+{
+	struct task *t = p1;
+	int64_t period = k_ms_to_ticks_ceil64(t->period_ms);
+	uint32_t work = k_ms_to_cyc_ceil32(t->work_ms);
+	int64_t release = start_tick;
+
+	k_sleep(K_TIMEOUT_ABS_TICKS(release));
+
+	while ((release < stop_tick) && (k_uptime_ticks() < stop_tick)) {
+		if (!use_cbs) {
+			k_thread_deadline_set(k_current_get(),
+					      (int)k_ms_to_cyc_ceil32(t->period_ms));
+		}
+
+		consume(work);
+
+		t->jobs++;
+		if (k_uptime_ticks() > release + period) {
+			t->misses++;
+		}
+
+		/* A late job makes the next one start right away */
+		release += period;
+		k_sleep(K_TIMEOUT_ABS_TICKS(release));
+	}
+}
+
+static void run(bool cbs)
+{
+	const char *mode = cbs ? "cbs" : "edf";
+	uint32_t jobs = 0U;
+	uint32_t misses = 0U;
+
+	use_cbs = cbs;
+	start_tick = k_uptime_ticks() + k_ms_to_ticks_ceil64(10);
+	stop_tick = start_tick + k_ms_to_ticks_ceil64(RUN_MS);
+
+	for (int i = 0; i < N_TASKS; i++) {
+		struct task *t = &tasks[i];
+
+		t->jobs = 0U;
+		t->misses = 0U;
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, task_entry,
+				t, NULL, NULL, TASK_PRIO, 0, K_FOREVER);
+
+		if (cbs) {
+			int ret = k_thread_cbs_set(&threads[i],
+						   k_ms_to_cyc_ceil32(t->budget_ms),
+						   k_ms_to_cyc_ceil32(t->period_ms));
+
+			if (ret != 0) {
+				printk("k_thread_cbs_set(%s) failed: %d\n",
+				       t->name, ret);
+			}
+		}
+	}
+
+	for (int i = 0; i < N_TASKS; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (int i = 0; i < N_TASKS; i++) {
+		struct task *t = &tasks[i];
+
+		k_thread_join(&threads[i], K_FOREVER);
+		printk("%-5s %-8s jobs %4u missed %4u\n",
+		       mode, t->name, t->jobs, t->misses);
+
+		if (!t->rogue) {
+			jobs += t->jobs;
+			misses += t->misses;
+		}
+	}
+
+	printk("%-5s well-behaved jobs %5u missed %4u (%u per mille)\n",
+	       mode, jobs, misses, jobs == 0U ? 0U : misses * 1000U / jobs);
+}
+
+/* With the four servers admitted (80%), another 30% must not fit */
+static void check_admission(void)
+{
+	int ret;
+
+	for (int i = 0; i < N_TASKS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, task_entry,
+				&tasks[i], NULL, NULL, TASK_PRIO, 0, K_FOREVER);
+		(void)k_thread_cbs_set(&threads[i],
+				       k_ms_to_cyc_ceil32(tasks[i].budget_ms),
+				       k_ms_to_cyc_ceil32(tasks[i].period_ms));
+	}
+
+	ret = k_thread_cbs_set(k_current_get(), k_ms_to_cyc_ceil32(3),
+			       k_ms_to_cyc_ceil32(10));
+	if (ret == -EBUSY) {
+		printk("admission: 30%% server on top of 80%% rejected\n");
+	} else {
+		printk("admission: 30%% server on top of 80%% accepted (%d)\n",
+		       ret);
+		(void)k_thread_cbs_set(k_current_get(), 0, 0);
+	}
+
+	/* Never started: aborting them releases their bandwidth */
+	for (int i = 0; i < N_TASKS; i++) {
+		k_thread_abort(&threads[i]);
+	}
+}
+
+int main(void)
+{
+	run(false);
+	run(true);
+	check_admission();
+
+	printk("fin\n");
+	return 0;
+}
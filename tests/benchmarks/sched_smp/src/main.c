@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* SMP scheduler scaling benchmark.  For each CPU count n, n pairs of
+ * threads are started.  The waker of pair i is pinned to CPU i and
+ * loops:
+ *
+ * 1. stamp, k_sem_give(ping), stamp (cost of the give)
+ * 2. k_sem_take(pong)
+ *
+ * while its partner, which may run on any of the first n CPUs, loops
+ * on k_sem_take(ping), records the time since the waker's first stamp
+ * (wake-to-run latency) and gives pong back.  Every pair is
+ * independent, so any slowdown as n grows comes from shared scheduler
+ * state: the run queue(s), and the semaphore and scheduler locks unless
+ * CONFIG_WAITQ_OBJ_LOCK gives each semaphore its own.
+ */
+
+#define N_RUNS 2000
+#define N_SETTLE 20
+#define STACK_SIZE 1024
+#define PRIO 4
+
+struct pair {
+	struct k_sem ping;
+	struct k_sem pong;
+	volatile uint32_t give_stamp;
+	uint64_t wake_total;
+	uint64_t give_total;
+};
+
+static struct pair pairs[CONFIG_MP_MAX_NUM_CPUS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(waker_stacks, CONFIG_MP_MAX_NUM_CPUS,
+				   STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(partner_stacks, CONFIG_MP_MAX_NUM_CPUS,
+				   STACK_SIZE);
+static struct k_thread wakers[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_thread partners[CONFIG_MP_MAX_NUM_CPUS];
+
+static void waker_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct pair *p = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < N_RUNS + N_SETTLE; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		p->give_stamp = start;
+		k_sem_give(&p->ping);
+
+		uint32_t given = k_cycle_get_32();
+
+		if (i >= N_SETTLE) {
+			p->give_total += given - start;
+		}
+
+		k_sem_take(&p->pong, K_FOREVER);
+	}
+}
+
+static void partner_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct pair *p = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < N_RUNS + N_SETTLE; i++) {
+		k_sem_take(&p->ping, K_FOREVER);
+
+		uint32_t woken = k_cycle_get_32();
+
+		if (i >= N_SETTLE) {
+			p->wake_total += woken - p->give_stamp;
+		}
+
+		k_sem_give(&p->pong);
+	}
+}
+
+static void run(unsigned int ncpus)
+{
+	uint64_t wake = 0U, give = 0U;
+
+	for (unsigned int i = 0; i < ncpus; i++) {
+		struct pair *p = &pairs[i];
+
+		k_sem_init(&p->ping, 0, 1);
+		k_sem_init(&p->pong, 0, 1);
+		p->wake_total = 0U;
+		p->give_total = 0U;
+
+		k_thread_create(&wakers[i], waker_stacks[i], STACK_SIZE,
+				waker_fn, p, NULL, NULL, PRIO, 0, K_FOREVER);
+		k_thread_create(&partners[i], partner_stacks[i], STACK_SIZE,
+				partner_fn, p, NULL, NULL, PRIO, 0, K_FOREVER);
+
+		k_thread_cpu_pin(&wakers[i], i);
+		k_thread_cpu_mask_clear(&partners[i]);
+		for (unsigned int cpu = 0; cpu < ncpus; cpu++) {
+			k_thread_cpu_mask_enable(&partners[i], cpu);
+		}
+	}
+
+	for (unsigned int i = 0; i < ncpus; i++) {
+		k_thread_start(&partners[i]);
+		k_thread_start(&wakers[i]);
+	}
+
+	for (unsigned int i = 0; i < ncpus; i++) {
+		k_thread_join(&wakers[i], K_FOREVER);
+		k_thread_join(&partners[i], K_FOREVER);
+		wake += pairs[i].wake_total;
+		give += pairs[i].give_total;
+	}
+
+	printk("cpus %2u wake-to-run %6u give %6u\n", ncpus,
+	       (uint32_t)(wake / (ncpus * N_RUNS)),
+	       (uint32_t)(give / (ncpus * N_RUNS)));
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	printk("%s run queues, %s wait queue locks, %u CPUs\n",
+	       IS_ENABLED(CONFIG_SCHED_CPU_RUNQ) ? "per-CPU" : "global",
+	       IS_ENABLED(CONFIG_WAITQ_OBJ_LOCK) ? "per-object" : "scheduler",
+	       num_cpus);
+
+	for (unsigned int n = 1; n <= num_cpus; n++) {
+		run(n);
+	}
+
+	printk("fin\n");
+	return 0;
+}
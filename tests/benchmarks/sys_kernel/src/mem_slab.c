@@ -20,6 +20,14 @@ K_MEM_SLAB_DEFINE_STATIC(my_slab,
 /* Array contains pointers to allocated regions. */
 static void *slab_array[MEM_SLAB_BLOCK_CNT];
 
+/* Threads for the per core count throughput test */
+#define MEM_SLAB_THREADS     CONFIG_MP_MAX_NUM_CPUS
+#define MEM_SLAB_STACK_SIZE  1024
+
+static K_THREAD_STACK_ARRAY_DEFINE(mem_slab_stacks, MEM_SLAB_THREADS,
+				   MEM_SLAB_STACK_SIZE);
+static struct k_thread mem_slab_threads[MEM_SLAB_THREADS];
+
 /**
  *
  * @brief Memslab allocation test function.
@@ -66,6 +74,86 @@ static int mem_slab_free_test(int no_of_loops)
 	return i;
 }
 
+/**
+ *
+ * @brief Memslab throughput thread.
+ *		  Allocates and immediately frees one block in a loop.
+ *
+ * @param par1   Address of the loop counter.
+ * @param par2   Number of loops.
+ * @param par3   Unused
+ *
+ */
+static void mem_slab_pair_thread(void *par1, void *par2, void *par3)
+{
+	int *pcounter = par1;
+	int num_loops = POINTER_TO_INT(par2);
+	void *block;
+	int i;
+
+	ARG_UNUSED(par3);
+
+	for (i = 0; i < num_loops; i++) {
+		if (k_mem_slab_alloc(&my_slab, &block, K_NO_WAIT) != 0) {
+			break;
+		}
+		k_mem_slab_free(&my_slab, block);
+	}
+
+	*pcounter = i;
+}
+
+/**
+ *
+ * @brief Memslab alloc/free throughput for 1 to N concurrent threads.
+ *
+ * One thread per CPU in use runs alloc/free pairs on the same slab.
+ * The aggregate number of pairs per millisecond is reported for each
+ * core count, showing how the slab scales under contention.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static int mem_slab_smp_test(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int counters[MEM_SLAB_THREADS];
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+
+	for (unsigned int n = 1; n <= num_cpus; n++) {
+		uint32_t t = k_cycle_get_32();
+		uint64_t ns;
+		int total = 0;
+
+		for (unsigned int j = 0; j < n; j++) {
+			k_thread_create(&mem_slab_threads[j], mem_slab_stacks[j],
+					MEM_SLAB_STACK_SIZE, mem_slab_pair_thread,
+					&counters[j], INT_TO_POINTER(number_of_loops),
+					NULL, prio, 0, K_NO_WAIT);
+		}
+
+		for (unsigned int j = 0; j < n; j++) {
+			k_thread_join(&mem_slab_threads[j], K_FOREVER);
+			total += counters[j];
+		}
+
+		ns = k_cyc_to_ns_floor64(k_cycle_get_32() - t);
+
+		if (total != n * number_of_loops) {
+			fprintf(output_file, sz_case_result_fmt, sz_fail);
+			fprintf(output_file, sz_case_end_fmt);
+			return 0;
+		}
+
+		fprintf(output_file, "\nCPUs: %u alloc/free pairs per ms: %u",
+			n, (uint32_t)((uint64_t)total * NSEC_PER_MSEC / MAX(ns, 1)));
+	}
+
+	fprintf(output_file, sz_case_result_fmt, sz_success);
+	fprintf(output_file, sz_case_end_fmt);
+
+	return 1;
+}
+
 int mem_slab_test(void)
 {
 	uint32_t t;
@@ -103,5 +191,16 @@ int mem_slab_test(void)
 
 	return_value += check_result(i, t);
 
+	/* Test alloc/free throughput per core count. */
+	fprintf(output_file, sz_test_case_fmt,
+		"Memslab #3");
+	fprintf(output_file, sz_description,
+		"\n\tk_mem_slab_alloc"
+		"\n\tk_mem_slab_free"
+		"\n\t(1 to N concurrent threads)");
+	printf(sz_test_start_fmt);
+
+	return_value += mem_slab_smp_test();
+
 	return return_value;
 }
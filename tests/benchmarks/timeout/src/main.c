@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <timeout_q.h>
+
+/* This is a timeout queue microbenchmark.  It arms N_TIMEOUTS kernel
+ * timeouts with pseudo-random durations of up to SPREAD_TICKS, then
+ * measures the average cost of:
+ *
+ * 1. Adding each of them with z_add_timeout()
+ * 2. Aborting each of them with z_abort_timeout()
+ * 3. Expiring all of them from one sys_clock_announce() call, which
+ *    includes invoking a trivial callback for each.
+ *
+ * sys_clock_announce() is called directly with interrupts locked so
+ * the timer driver cannot announce concurrently.  This makes the
+ * kernel's notion of time jump ahead, which is harmless here.
+ */
+
+#define N_TIMEOUTS 10000
+#define SPREAD_TICKS 100000
+#define N_RUNS 3
+
+static struct _timeout timeouts[N_TIMEOUTS];
+static uint32_t durations[N_TIMEOUTS];
+static uint32_t expired;
+
+static void expiry_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	expired++;
+}
+
+/* Simple LCG so every backend sees the same sequence */
+static uint32_t next_rand(uint32_t *state)
+{
+	*state = *state * 1103515245U + 12345U;
+	return *state >> 8;
+}
+
+static uint32_t arm_all(void)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < N_TIMEOUTS; i++) {
+		z_add_timeout(&timeouts[i], expiry_fn, K_TICKS(durations[i]));
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+static uint32_t abort_all(void)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < N_TIMEOUTS; i++) {
+		(void)z_abort_timeout(&timeouts[i]);
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+static uint32_t expire_all(void)
+{
+	unsigned int key = irq_lock();
+	uint32_t start = k_cycle_get_32();
+
+	sys_clock_announce(SPREAD_TICKS + 1);
+
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	irq_unlock(key);
+
+	return cycles;
+}
+
+int main(void)
+{
+	uint32_t seed = 42U;
+
+	for (int i = 0; i < N_TIMEOUTS; i++) {
+		z_init_timeout(&timeouts[i]);
+		durations[i] = 1U + next_rand(&seed) % SPREAD_TICKS;
+	}
+
+	printk("%d timeouts spread over %d ticks, %s backend\n",
+	       N_TIMEOUTS, SPREAD_TICKS,
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "wheel" : "dlist");
+
+	for (int run = 0; run < N_RUNS; run++) {
+		uint32_t insert = arm_all();
+		uint32_t abort = abort_all();
+
+		(void)arm_all();
+		expired = 0U;
+		uint32_t expire = expire_all();
+
+		if (expired != N_TIMEOUTS) {
+			printk("only %u of %d timeouts expired\n", expired,
+			       N_TIMEOUTS);
+			return 0;
+		}
+
+		printk("run %d:\n", run);
+		printk("insert %6u cycles/op\n", insert / N_TIMEOUTS);
+		printk("abort  %6u cycles/op\n", abort / N_TIMEOUTS);
+		printk("expire %6u cycles/op\n", expire / N_TIMEOUTS);
+	}
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Work queue submission benchmark.  Each of up to MAX_SUBMITTERS
+ * threads owns MAX_BATCH work items and, for N_ROUNDS rounds, submits
+ * them to a higher priority cooperative work queue, either one at a
+ * time with k_work_submit_to_queue() or batch items at a time with
+ * k_work_submit_batch().  As the queue thread preempts the submitter,
+ * every item has run before its submitter is resumed, so all items are
+ * idle at the start of each round.
+ */
+
+#define MAX_SUBMITTERS 4
+#define MAX_BATCH 32
+#define N_ROUNDS 200
+#define STACK_SIZE 1024
+#define SUBMITTER_PRIO 5
+#define WORKQ_PRIO K_PRIO_COOP(1)
+
+static K_THREAD_STACK_DEFINE(workq_stack, STACK_SIZE);
+static struct k_work_q workq;
+
+static K_THREAD_STACK_ARRAY_DEFINE(submitter_stacks, MAX_SUBMITTERS,
+				   STACK_SIZE);
+static struct k_thread submitters[MAX_SUBMITTERS];
+
+static struct k_work items[MAX_SUBMITTERS][MAX_BATCH];
+static struct k_work *item_ptrs[MAX_SUBMITTERS][MAX_BATCH];
+static uint32_t handled;
+
+static void work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	handled++;
+}
+
+static void submitter_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct k_work **works = arg1;
+	uint32_t batch = POINTER_TO_UINT(arg2);
+
+	ARG_UNUSED(arg3);
+
+	for (int round = 0; round < N_ROUNDS; round++) {
+		for (int i = 0; i < MAX_BATCH; i += batch) {
+			if (batch == 1U) {
+				(void)k_work_submit_to_queue(&workq, works[i]);
+			} else {
+				(void)k_work_submit_batch(&workq, &works[i],
+							  batch);
+			}
+		}
+	}
+}
+
+static void run(unsigned int nthreads, uint32_t batch)
+{
+	uint32_t expected = nthreads * N_ROUNDS * MAX_BATCH;
+	uint32_t start, cycles;
+
+	handled = 0U;
+
+	for (unsigned int t = 0; t < nthreads; t++) {
+		k_thread_create(&submitters[t], submitter_stacks[t],
+				STACK_SIZE, submitter_fn, item_ptrs[t],
+				UINT_TO_POINTER(batch), NULL, SUBMITTER_PRIO,
+				0, K_FOREVER);
+	}
+
+	start = k_cycle_get_32();
+
+	for (unsigned int t = 0; t < nthreads; t++) {
+		k_thread_start(&submitters[t]);
+	}
+	for (unsigned int t = 0; t < nthreads; t++) {
+		k_thread_join(&submitters[t], K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	if (handled != expected) {
+		printk("only %u of %u items ran\n", handled, expected);
+		return;
+	}
+
+	printk("submitters %u batch %2u %10u items/s %6u cycles/item\n",
+	       nthreads, batch,
+	       (uint32_t)(((uint64_t)expected * sys_clock_hw_cycles_per_sec()) /
+			  cycles),
+	       cycles / expected);
+}
+
+int main(void)
+{
+	static const uint32_t batches[] = { 1, 8, 32 };
+	static const unsigned int threads[] = { 1, MAX_SUBMITTERS };
+
+	k_work_queue_start(&workq, workq_stack, STACK_SIZE, WORKQ_PRIO, NULL);
+
+	for (int t = 0; t < MAX_SUBMITTERS; t++) {
+		for (int i = 0; i < MAX_BATCH; i++) {
+			k_work_init(&items[t][i], work_handler);
+			item_ptrs[t][i] = &items[t][i];
+		}
+	}
+
+	/* Let the queue thread start and block */
+	k_sleep(K_MSEC(10));
+
+	for (int t = 0; t < ARRAY_SIZE(threads); t++) {
+		for (int b = 0; b < ARRAY_SIZE(batches); b++) {
+			run(threads[t], batches[b]);
+		}
+	}
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Work queue pool scaling benchmark.  For each pool size, N_ITEMS work
+ * items that each busy-wait for ITEM_US are submitted from the main
+ * thread in one burst, optionally behind one item that busy-waits for
+ * SLOW_US, and the time until all the short items have run is
+ * measured.  All submissions come from outside the pool, so any
+ * parallelism comes from idle-worker selection and stealing.
+ */
+
+#define N_ITEMS 64
+#define ITEM_US 200
+#define SLOW_US (50 * ITEM_US)
+#define STACK_SIZE 1024
+#define PRIO 4
+
+K_WORK_POOL_DEFINE(pool_1, 1, STACK_SIZE);
+K_WORK_POOL_DEFINE(pool_2, 2, STACK_SIZE);
+K_WORK_POOL_DEFINE(pool_4, 4, STACK_SIZE);
+
+static struct k_work items[N_ITEMS];
+static struct k_work slow_item;
+static atomic_t done;
+static K_SEM_DEFINE(all_done, 0, 1);
+
+static void item_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_busy_wait(ITEM_US);
+
+	if (atomic_inc(&done) == (N_ITEMS - 1)) {
+		k_sem_give(&all_done);
+	}
+}
+
+static void slow_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_busy_wait(SLOW_US);
+}
+
+static void run(struct k_work_pool *pool, unsigned int nworkers,
+		bool slow)
+{
+	struct k_work_sync sync;
+	uint32_t start, cycles, us;
+
+	atomic_set(&done, 0);
+	k_sem_reset(&all_done);
+
+	start = k_cycle_get_32();
+
+	if (slow) {
+		(void)k_work_pool_submit(pool, &slow_item);
+	}
+	for (int i = 0; i < N_ITEMS; i++) {
+		(void)k_work_pool_submit(pool, &items[i]);
+	}
+
+	k_sem_take(&all_done, K_FOREVER);
+	cycles = k_cycle_get_32() - start;
+
+	if (slow) {
+		(void)k_work_flush(&slow_item, &sync);
+	}
+
+	us = (uint32_t)k_cyc_to_us_floor64(cycles);
+	printk("workers %u %-9s %8u us %8u items/s\n", nworkers,
+	       slow ? "slow head" : "uniform", us,
+	       (uint32_t)((N_ITEMS * 1000000ULL) / MAX(us, 1U)));
+}
+
+int main(void)
+{
+	static struct {
+		struct k_work_pool *pool;
+		unsigned int nworkers;
+	} pools[] = {
+		{ &pool_1, 1 },
+		{ &pool_2, 2 },
+		{ &pool_4, 4 },
+	};
+	const struct k_work_pool_config cfg = {
+		.name = "bench",
+		.pin_cpus = true,
+	};
+
+	for (int i = 0; i < N_ITEMS; i++) {
+		k_work_init(&items[i], item_handler);
+	}
+	k_work_init(&slow_item, slow_handler);
+
+	printk("%u CPUs, %d items of %d us\n", arch_num_cpus(), N_ITEMS,
+	       ITEM_US);
+
+	for (int i = 0; i < ARRAY_SIZE(pools); i++) {
+		k_work_pool_start(pools[i].pool, PRIO, &cfg);
+		run(pools[i].pool, pools[i].nworkers, false);
+		run(pools[i].pool, pools[i].nworkers, true);
+		(void)k_work_pool_drain(pools[i].pool, true);
+	}
+
+	printk("fin\n");
+	return 0;
+}
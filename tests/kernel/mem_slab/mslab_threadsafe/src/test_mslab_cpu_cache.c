@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/atomic.h>
+
+/* Per-CPU block caches: blocks cached by one CPU must be found by the
+ * others, and a thread must not sleep while blocks sit in caches.
+ */
+
+#define CACHE_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define CACHE_THREADS 4
+#define CACHE_BLOCKS CACHE_THREADS
+#define CACHE_LOOPS 2000
+#define CACHE_BLK_SIZE 16
+
+K_MEM_SLAB_DEFINE_STATIC(cache_slab, CACHE_BLK_SIZE, CACHE_BLOCKS, 4);
+static K_THREAD_STACK_ARRAY_DEFINE(cache_stack, CACHE_THREADS, CACHE_STACK_SIZE);
+static struct k_thread cache_thread[CACHE_THREADS];
+static atomic_t cache_failures;
+
+/* Start a thread created with K_FOREVER, spread over the CPUs */
+static void start_on_cpu(struct k_thread *thread, int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	k_thread_cpu_mask_clear(thread);
+	k_thread_cpu_mask_enable(thread, cpu % arch_num_cpus());
+#else
+	ARG_UNUSED(cpu);
+#endif
+	k_thread_start(thread);
+}
+
+static void run_on_cpu(int cpu, k_thread_entry_t entry, void *p1)
+{
+	k_thread_create(&cache_thread[0], cache_stack[0], CACHE_STACK_SIZE,
+			entry, p1, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_FOREVER);
+	start_on_cpu(&cache_thread[0], cpu);
+	zassert_ok(k_thread_join(&cache_thread[0], K_FOREVER));
+}
+
+/* Allocate every block, then free them all: they end up cached */
+static void alloc_free_all(void *p1, void *p2, void *p3)
+{
+	void *blocks[CACHE_BLOCKS];
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < CACHE_BLOCKS; i++) {
+		zassert_ok(k_mem_slab_alloc(&cache_slab, &blocks[i], K_NO_WAIT));
+	}
+
+	for (int i = 0; i < CACHE_BLOCKS; i++) {
+		k_mem_slab_free(&cache_slab, blocks[i]);
+	}
+}
+
+/* Allocate every block, with the given timeout, and free them again */
+static void alloc_all(void *p1, void *p2, void *p3)
+{
+	k_timeout_t *timeout = p1;
+	void *blocks[CACHE_BLOCKS];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < CACHE_BLOCKS; i++) {
+		zassert_ok(k_mem_slab_alloc(&cache_slab, &blocks[i], *timeout),
+			   "block %d not found in the caches", i);
+	}
+
+	for (int i = 0; i < CACHE_BLOCKS; i++) {
+		k_mem_slab_free(&cache_slab, blocks[i]);
+	}
+}
+
+ZTEST(mslab_threadsafe, test_mslab_cpu_cache_drain)
+{
+	k_timeout_t no_wait = K_NO_WAIT;
+	k_timeout_t wait = K_MSEC(100);
+
+	if (!IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE)) {
+		ztest_test_skip();
+	}
+
+	/* Blocks cached by CPU 0 are allocated from the last CPU, without
+	 * waiting and with a timeout no free will ever end.
+	 */
+	run_on_cpu(0, alloc_free_all, NULL);
+	zassert_equal(k_mem_slab_num_free_get(&cache_slab), CACHE_BLOCKS);
+	run_on_cpu(arch_num_cpus() - 1, alloc_all, &no_wait);
+
+	run_on_cpu(0, alloc_free_all, NULL);
+	run_on_cpu(arch_num_cpus() - 1, alloc_all, &wait);
+
+	zassert_equal(k_mem_slab_num_free_get(&cache_slab), CACHE_BLOCKS);
+}
+
+static void hold_one(void *p1, void *p2, void *p3)
+{
+	k_timeout_t *timeout = p1;
+	void *block;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < CACHE_LOOPS; i++) {
+		if (k_mem_slab_alloc(&cache_slab, &block, *timeout) != 0) {
+			atomic_inc(&cache_failures);
+			continue;
+		}
+
+		k_mem_slab_free(&cache_slab, block);
+	}
+}
+
+/* As many threads as blocks, each holding at most one block at a time:
+ * an allocation must never fail nor time out, whichever cache the free
+ * blocks are in.
+ */
+static void run_hold_one(k_timeout_t timeout)
+{
+	atomic_set(&cache_failures, 0);
+
+	for (int i = 0; i < CACHE_THREADS; i++) {
+		k_thread_create(&cache_thread[i], cache_stack[i], CACHE_STACK_SIZE,
+				hold_one, &timeout, NULL, NULL, K_PRIO_PREEMPT(1), 0,
+				K_FOREVER);
+	}
+
+	for (int i = 0; i < CACHE_THREADS; i++) {
+		start_on_cpu(&cache_thread[i], i);
+	}
+
+	for (int i = 0; i < CACHE_THREADS; i++) {
+		zassert_ok(k_thread_join(&cache_thread[i], K_FOREVER));
+	}
+
+	zassert_equal(atomic_get(&cache_failures), 0, "%d allocations failed",
+		      (int)atomic_get(&cache_failures));
+}
+
+ZTEST(mslab_threadsafe, test_mslab_cpu_cache_no_wait)
+{
+	if (!IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE)) {
+		ztest_test_skip();
+	}
+
+	run_hold_one(K_NO_WAIT);
+	zassert_equal(k_mem_slab_num_free_get(&cache_slab), CACHE_BLOCKS);
+}
+
+ZTEST(mslab_threadsafe, test_mslab_cpu_cache_no_lost_wakeup)
+{
+	if (!IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE)) {
+		ztest_test_skip();
+	}
+
+	void *spare;
+
+	/* Fewer blocks than threads, so that threads do pend while
+	 * others free
+	 */
+	zassert_ok(k_mem_slab_alloc(&cache_slab, &spare, K_NO_WAIT));
+	run_hold_one(K_MSEC(1000));
+	k_mem_slab_free(&cache_slab, spare);
+	zassert_equal(k_mem_slab_num_free_get(&cache_slab), CACHE_BLOCKS);
+}
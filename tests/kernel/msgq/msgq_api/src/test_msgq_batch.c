@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 4
+
+static K_THREAD_STACK_DEFINE(batch_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(batch_stack1, STACK_SIZE);
+static struct k_thread batch_tdata;
+static struct k_thread batch_tdata1;
+static struct k_msgq batch_msgq;
+static char __aligned(4) batch_buffer[MSG_SIZE * BATCH_LEN];
+
+static uint32_t tx[2 * BATCH_LEN];
+static uint32_t rx[2 * BATCH_LEN];
+static uint32_t thread_rx[2];
+static int thread_ret[2];
+
+static void batch_init(void)
+{
+	k_msgq_init(&batch_msgq, batch_buffer, MSG_SIZE, BATCH_LEN);
+
+	for (int i = 0; i < ARRAY_SIZE(tx); i++) {
+		tx[i] = MSG0 + i;
+	}
+	(void)memset(rx, 0, sizeof(rx));
+}
+
+static void check_rx(uint32_t first, int count)
+{
+	for (int i = 0; i < count; i++) {
+		zassert_equal(rx[i], tx[first + i], "message %d out of order", i);
+	}
+}
+
+/* Put the messages given by p1 and p2 after the caller blocked */
+static void put_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret[0] = k_msgq_put_many(&batch_msgq, &tx[POINTER_TO_INT(p1)],
+					POINTER_TO_INT(p2), K_NO_WAIT);
+}
+
+/* Get up to p1 messages after the caller blocked */
+static void get_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret[0] = k_msgq_get_many(&batch_msgq, rx, POINTER_TO_INT(p1),
+					K_NO_WAIT);
+}
+
+static void get_entry(void *p1, void *p2, void *p3)
+{
+	int i = POINTER_TO_INT(p1);
+
+	thread_ret[i] = k_msgq_get(&batch_msgq, &thread_rx[i], K_FOREVER);
+}
+
+static void put_many_timeout_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret[0] = k_msgq_put_many(&batch_msgq, tx, 2, TIMEOUT);
+}
+
+static void spawn(struct k_thread *thread, k_thread_stack_t *stack,
+		  k_thread_entry_t entry, int p1, int p2)
+{
+	k_thread_create(thread, stack, STACK_SIZE, entry,
+			INT_TO_POINTER(p1), INT_TO_POINTER(p2), NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test batch transfers that only partially fit
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_partial)
+{
+	batch_init();
+
+	/**TESTPOINT: only as many messages as fit are put */
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, BATCH_LEN + 2, K_NO_WAIT),
+		      BATCH_LEN);
+	zassert_equal(k_msgq_num_free_get(&batch_msgq), 0);
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, 1, K_NO_WAIT), -ENOMSG);
+
+	/**TESTPOINT: only as many messages as queued are received */
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, 3, K_NO_WAIT), 3);
+	check_rx(0, 3);
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, BATCH_LEN, K_NO_WAIT), 1);
+	check_rx(3, 1);
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, 1, K_NO_WAIT), -ENOMSG);
+}
+
+/**
+ * @brief Test batch transfers across the end of the ring buffer
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_wrap)
+{
+	batch_init();
+
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, 3, K_NO_WAIT), 3);
+
+	/**TESTPOINT: put and get wrap around the end of the buffer */
+	zassert_equal(k_msgq_put_many(&batch_msgq, &tx[3], BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+	check_rx(3, BATCH_LEN);
+
+	/**TESTPOINT: batch and single calls see the same order */
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, 2, K_NO_WAIT), 2);
+	zassert_equal(k_msgq_put(&batch_msgq, &tx[2], K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get(&batch_msgq, &rx[0], K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_many(&batch_msgq, &rx[1], 2, K_NO_WAIT), 2);
+	check_rx(0, 3);
+}
+
+/**
+ * @brief Test batch transfers timing out
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_timeout)
+{
+	int64_t start;
+
+	batch_init();
+
+	start = k_uptime_get();
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, 2, TIMEOUT), -EAGAIN);
+	zassert_true(k_uptime_get() - start >= TIMEOUT_MS);
+
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+
+	start = k_uptime_get();
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, 2, TIMEOUT), -EAGAIN);
+	zassert_true(k_uptime_get() - start >= TIMEOUT_MS);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), BATCH_LEN);
+}
+
+/**
+ * @brief Test a blocked batch get completing with what is queued
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_get_blocking)
+{
+	batch_init();
+
+	spawn(&batch_tdata, batch_stack, put_many_entry, 0, 3);
+
+	/**TESTPOINT: the first message wakes us, the others follow */
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, BATCH_LEN, K_FOREVER), 3);
+	check_rx(0, 3);
+
+	k_thread_join(&batch_tdata, K_FOREVER);
+	zassert_equal(thread_ret[0], 3);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 0);
+}
+
+/**
+ * @brief Test a blocked batch put completing with the room freed
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_put_blocking)
+{
+	batch_init();
+
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+
+	spawn(&batch_tdata, batch_stack, get_many_entry, BATCH_LEN, 0);
+
+	/**TESTPOINT: the receiver takes the first message into the ring,
+	 * the others fit once we are woken
+	 */
+	zassert_equal(k_msgq_put_many(&batch_msgq, &tx[BATCH_LEN], 3, K_FOREVER),
+		      3);
+
+	k_thread_join(&batch_tdata, K_FOREVER);
+	zassert_equal(thread_ret[0], BATCH_LEN);
+	check_rx(0, BATCH_LEN);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, BATCH_LEN, K_NO_WAIT), 3);
+	check_rx(BATCH_LEN, 3);
+}
+
+/**
+ * @brief Test a batch put handing messages to every waiting receiver
+ * @see k_msgq_put_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_wake_waiters)
+{
+	batch_init();
+
+	spawn(&batch_tdata, batch_stack, get_entry, 0, 0);
+	spawn(&batch_tdata1, batch_stack1, get_entry, 1, 0);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: both receivers get one, the rest is queued */
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 1);
+
+	k_thread_join(&batch_tdata, K_FOREVER);
+	k_thread_join(&batch_tdata1, K_FOREVER);
+	zassert_equal(thread_ret[0], 0);
+	zassert_equal(thread_ret[1], 0);
+	zassert_equal(thread_rx[0], tx[0]);
+	zassert_equal(thread_rx[1], tx[1]);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, rx, BATCH_LEN, K_NO_WAIT), 1);
+	check_rx(2, 1);
+}
+
+/**
+ * @brief Test purging a message queue while a batch put waits
+ * @see k_msgq_put_many(), k_msgq_purge()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_purge)
+{
+	batch_init();
+
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+
+	spawn(&batch_tdata, batch_stack, put_many_timeout_entry, 0, 0);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: the waiting batch put fails and nothing is left */
+	k_msgq_purge(&batch_msgq);
+
+	k_thread_join(&batch_tdata, K_FOREVER);
+	zassert_equal(thread_ret[0], -ENOMSG);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 0);
+
+	zassert_equal(k_msgq_put_many(&batch_msgq, tx, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define CLAIM_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define CLAIM_PIPE_LEN 16
+#define XFER_LEN 4
+
+static K_THREAD_STACK_DEFINE(claim_stack, CLAIM_STACK_SIZE);
+static struct k_thread claim_tdata;
+
+static unsigned char __aligned(4) claim_buffer[CLAIM_PIPE_LEN];
+static struct k_pipe claim_pipe;
+
+static unsigned char thread_data[XFER_LEN];
+static size_t thread_bytes;
+static int thread_ret;
+
+static void claim_pipe_init(void)
+{
+	k_pipe_init(&claim_pipe, claim_buffer, sizeof(claim_buffer));
+}
+
+/* Move the read and write indexes to @a offset in an empty pipe */
+static void claim_pipe_advance(size_t offset)
+{
+	unsigned char tmp[CLAIM_PIPE_LEN];
+	size_t bytes;
+
+	zassert_ok(k_pipe_put(&claim_pipe, tmp, offset, &bytes, offset, K_NO_WAIT));
+	zassert_ok(k_pipe_get(&claim_pipe, tmp, offset, &bytes, offset, K_NO_WAIT));
+}
+
+static void fill(unsigned char *data, size_t len, unsigned char first)
+{
+	for (size_t i = 0; i < len; i++) {
+		data[i] = first + i;
+	}
+}
+
+static void check(const unsigned char *data, size_t len, unsigned char first)
+{
+	for (size_t i = 0; i < len; i++) {
+		zassert_equal(data[i], (unsigned char)(first + i),
+			      "byte %u differs", (unsigned int)i);
+	}
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_pipe_get(&claim_pipe, thread_data, XFER_LEN,
+				&thread_bytes, XFER_LEN, K_FOREVER);
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	fill(thread_data, XFER_LEN, 'w');
+	thread_ret = k_pipe_put(&claim_pipe, thread_data, XFER_LEN,
+				&thread_bytes, XFER_LEN, K_FOREVER);
+}
+
+/* Start a thread and let it block on the pipe */
+static void spawn_blocked(k_thread_entry_t entry)
+{
+	k_thread_create(&claim_tdata, claim_stack, CLAIM_STACK_SIZE, entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(10);
+}
+
+/**
+ * @addtogroup kernel_pipe_tests
+ * @{
+ */
+
+/**
+ * @brief Test claims that cross the end of the pipe buffer
+ * @see k_pipe_put_claim(), k_pipe_get_claim()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_wrap)
+{
+	unsigned char rx[CLAIM_PIPE_LEN];
+	unsigned char *data;
+	size_t bytes;
+
+	claim_pipe_init();
+	claim_pipe_advance(12);
+
+	/**TESTPOINT: a write claim stops at the end of the buffer and the
+	 * next one continues at its start
+	 */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 8), 4);
+	zassert_equal_ptr(data, &claim_buffer[12]);
+	fill(data, 4, 'a');
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 8), 8);
+	zassert_equal_ptr(data, &claim_buffer[0]);
+	fill(data, 8, 'a' + 4);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 12));
+
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 12);
+	zassert_ok(k_pipe_get(&claim_pipe, rx, 12, &bytes, 12, K_NO_WAIT));
+	check(rx, 12, 'a');
+
+	/**TESTPOINT: same for read claims, from index 8 */
+	fill(rx, 12, 'A');
+	zassert_ok(k_pipe_put(&claim_pipe, rx, 12, &bytes, 12, K_NO_WAIT));
+
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, 12), 8);
+	zassert_equal_ptr(data, &claim_buffer[8]);
+	check(data, 8, 'A');
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, 12), 4);
+	zassert_equal_ptr(data, &claim_buffer[0]);
+	check(data, 4, 'A' + 8);
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 12));
+
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN);
+}
+
+/**
+ * @brief Test finishing less than was claimed
+ * @see k_pipe_put_finish(), k_pipe_get_finish()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_finish_short)
+{
+	unsigned char rx[CLAIM_PIPE_LEN];
+	unsigned char *data;
+	size_t bytes;
+
+	claim_pipe_init();
+
+	/**TESTPOINT: only the finished part of a write claim is readable,
+	 * the rest is claimed again next time
+	 */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 8), 8);
+	fill(data, 8, 'a');
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 5));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 5);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN - 5);
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 8), 8);
+	zassert_equal_ptr(data, &claim_buffer[5]);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 0));
+
+	/**TESTPOINT: only the finished part of a read claim is consumed */
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, 5), 5);
+	check(data, 5, 'a');
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 2));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 3);
+
+	zassert_ok(k_pipe_get(&claim_pipe, rx, 3, &bytes, 3, K_NO_WAIT));
+	check(rx, 3, 'a' + 2);
+}
+
+/**
+ * @brief Test the available byte counts while claims are outstanding
+ * @see k_pipe_read_avail(), k_pipe_write_avail()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_avail)
+{
+	unsigned char *data;
+
+	claim_pipe_init();
+
+	/**TESTPOINT: claimed space is not available for writing, and only
+	 * becomes readable once finished
+	 */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 10), 10);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN - 10);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 6));
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN - 6);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 6);
+
+	/**TESTPOINT: claimed data is not available for reading, and its
+	 * space only becomes writable once finished
+	 */
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, 4), 4);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 2);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN - 6);
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 4));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 2);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN - 2);
+
+	/**TESTPOINT: both at once */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 3), 3);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, 1), 1);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN - 5);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 1);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 0));
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 0));
+}
+
+/**
+ * @brief Test finishing a write claim with a reader waiting
+ * @see k_pipe_put_claim(), k_pipe_put_finish()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_reader_blocked)
+{
+	unsigned char tmp[XFER_LEN];
+	unsigned char *data;
+	size_t bytes;
+
+	claim_pipe_init();
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, XFER_LEN), XFER_LEN);
+
+	/**TESTPOINT: copies do not use the claimed space */
+	zassert_equal(k_pipe_put(&claim_pipe, tmp, sizeof(tmp), &bytes, 1,
+				 K_NO_WAIT), -EIO);
+
+	spawn_blocked(reader_entry);
+
+	/**TESTPOINT: the finish call serves the waiting reader */
+	fill(data, XFER_LEN, 'c');
+	zassert_ok(k_pipe_put_finish(&claim_pipe, XFER_LEN));
+
+	k_thread_join(&claim_tdata, K_FOREVER);
+	zassert_ok(thread_ret);
+	zassert_equal(thread_bytes, XFER_LEN);
+	check(thread_data, XFER_LEN, 'c');
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+}
+
+/**
+ * @brief Test finishing a read claim with a writer waiting
+ * @see k_pipe_get_claim(), k_pipe_get_finish()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_writer_blocked)
+{
+	unsigned char rx[CLAIM_PIPE_LEN];
+	unsigned char *data;
+	size_t bytes;
+
+	claim_pipe_init();
+
+	fill(rx, CLAIM_PIPE_LEN, 'a');
+	zassert_ok(k_pipe_put(&claim_pipe, rx, CLAIM_PIPE_LEN, &bytes,
+			      CLAIM_PIPE_LEN, K_NO_WAIT));
+
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, CLAIM_PIPE_LEN),
+		      CLAIM_PIPE_LEN);
+
+	/**TESTPOINT: copies do not consume the claimed data */
+	zassert_equal(k_pipe_get(&claim_pipe, rx, 1, &bytes, 1, K_NO_WAIT),
+		      -EIO);
+
+	spawn_blocked(writer_entry);
+
+	/**TESTPOINT: the finish call lets the waiting writer in */
+	check(data, XFER_LEN, 'a');
+	zassert_ok(k_pipe_get_finish(&claim_pipe, XFER_LEN));
+
+	k_thread_join(&claim_tdata, K_FOREVER);
+	zassert_ok(thread_ret);
+	zassert_equal(thread_bytes, XFER_LEN);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), CLAIM_PIPE_LEN);
+
+	zassert_ok(k_pipe_get(&claim_pipe, rx, CLAIM_PIPE_LEN, &bytes,
+			      CLAIM_PIPE_LEN, K_NO_WAIT));
+	check(rx, CLAIM_PIPE_LEN - XFER_LEN, 'a' + XFER_LEN);
+	check(&rx[CLAIM_PIPE_LEN - XFER_LEN], XFER_LEN, 'w');
+}
+
+/**
+ * @brief Test claim and finish error returns
+ * @see k_pipe_put_claim(), k_pipe_put_finish(), k_pipe_get_claim(),
+ * k_pipe_get_finish()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_fail)
+{
+	struct k_pipe unbuffered;
+	unsigned char *data;
+
+	claim_pipe_init();
+
+	/**TESTPOINT: nothing to read from an empty pipe */
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, 1), 0);
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 0));
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 1), -EINVAL);
+
+	/**TESTPOINT: finishing more than claimed */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 4), 4);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 5), -EINVAL);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 4));
+
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &data, 8), 4);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 5), -EINVAL);
+	zassert_ok(k_pipe_get_finish(&claim_pipe, 4));
+
+	/**TESTPOINT: no room in a full pipe */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, CLAIM_PIPE_LEN),
+		      CLAIM_PIPE_LEN);
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 1), 0);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, CLAIM_PIPE_LEN));
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 1), 0);
+
+	/**TESTPOINT: an unbuffered pipe has nothing to claim */
+	k_pipe_init(&unbuffered, NULL, 0);
+	zassert_equal(k_pipe_put_claim(&unbuffered, &data, 1), 0);
+	zassert_equal(k_pipe_get_claim(&unbuffered, &data, 1), 0);
+}
+
+/**
+ * @}
+ */
@@ -836,3 +836,100 @@ ZTEST(poll_api_1cpu, test_detect_is_polling)
 
 	k_thread_abort(tid);
 }
+
+#define SET_NUM_SEMS 4
+
+static struct k_sem set_sems[SET_NUM_SEMS];
+static struct k_poll_signal set_signal;
+
+static void poll_set_give_helper(void *p1, void *p2, void *p3)
+{
+	k_sleep(K_MSEC(50));
+	k_sem_give(p1);
+}
+
+/**
+ * @brief Test waiting on a persistent poll set
+ *
+ * @details
+ * Add several semaphores and a signal to a poll set, and check that
+ * a wait reports exactly the events that are ready, keeps reporting
+ * them until their condition goes away, and that events keep their
+ * registration across waits, including one made ready by another
+ * thread while the main thread is waiting.
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set)
+{
+	struct k_poll_event events[SET_NUM_SEMS + 1];
+	struct k_poll_event *ready[SET_NUM_SEMS + 1];
+	struct k_poll_set set;
+
+	k_poll_set_init(&set);
+	k_poll_signal_init(&set_signal);
+
+	for (int i = 0; i < SET_NUM_SEMS; i++) {
+		k_sem_init(&set_sems[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_sems[i]);
+		events[i].tag = i;
+		zassert_ok(k_poll_set_add(&set, &events[i]));
+	}
+	k_poll_event_init(&events[SET_NUM_SEMS], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	events[SET_NUM_SEMS].tag = SET_NUM_SEMS;
+	zassert_ok(k_poll_set_add(&set, &events[SET_NUM_SEMS]));
+
+	zassert_equal(k_poll_set_add(&set, &events[0]), -EBUSY);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+
+	/* Ready events are reported, and again while they stay ready */
+	k_sem_give(&set_sems[1]);
+	k_poll_signal_raise(&set_signal, SIGNAL_RESULT);
+	for (int pass = 0; pass < 2; pass++) {
+		zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+					      K_NO_WAIT), 2);
+		zassert_equal(ready[0]->tag, 1);
+		zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+		zassert_equal(ready[1]->tag, SET_NUM_SEMS);
+		zassert_equal(ready[1]->state, K_POLL_STATE_SIGNALED);
+	}
+
+	/* A short array gets the oldest events first */
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 1);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, SET_NUM_SEMS);
+
+	/* Consumed events are armed again */
+	zassert_ok(k_sem_take(&set_sems[1], K_NO_WAIT));
+	k_poll_signal_reset(&set_signal);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+
+	k_thread_create(&test_thread, test_stack,
+			K_THREAD_STACK_SIZEOF(test_stack),
+			poll_set_give_helper, &set_sems[1], NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_FOREVER), 1);
+	zassert_equal(ready[0]->tag, 1);
+	zassert_ok(k_sem_take(&set_sems[1], K_NO_WAIT));
+	k_thread_join(&test_thread, K_FOREVER);
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_MSEC(20)), -EAGAIN);
+
+	/* Removed events are no longer reported */
+	zassert_ok(k_poll_set_remove(&set, &events[2]));
+	zassert_equal(k_poll_set_remove(&set, &events[2]), -EINVAL);
+	k_sem_give(&set_sems[2]);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+
+	for (int i = 0; i < ARRAY_SIZE(events); i++) {
+		(void)k_poll_set_remove(&set, &events[i]);
+	}
+}
@@ -213,4 +213,108 @@ ZTEST(suite_deadline, test_unqueued)
 	}
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Validate admission control of constant bandwidth servers
+ *
+ * @details Servers are admitted while their total utilization stays
+ * within CONFIG_SCHED_DEADLINE_CBS_MAX_UTIL, and releasing a server
+ * makes its bandwidth available again.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs_admission)
+{
+	for (int i = 0; i < 2; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				STACK_SIZE, worker, INT_TO_POINTER(i), NULL,
+				NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+				K_FOREVER);
+	}
+
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 2000, 1000),
+		      -EINVAL, "budget above period accepted");
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 600, 1000), 0);
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], 500, 1000),
+		      -EBUSY, "utilization above 100% accepted");
+
+	/* Shrinking an admitted server only counts its new bandwidth */
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 400, 1000), 0);
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], 500, 1000), 0);
+
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 0, 0), 0);
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 500, 1000), 0);
+
+	/* Aborting a server releases its bandwidth */
+	k_thread_abort(&worker_threads[1]);
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 1000, 1000), 0);
+
+	k_thread_abort(&worker_threads[0]);
+}
+
+static volatile uint32_t low_prio_progress;
+
+static void cbs_spinner(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		/* Never yields, only throttling lets others run */
+	}
+}
+
+static void cbs_low_prio(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		low_prio_progress++;
+	}
+}
+
+/**
+ * @brief Validate that a server is throttled once its budget is used
+ *
+ * @details A high priority thread that never blocks is given a budget
+ * of a fifth of its period.  It must not get much more than that share
+ * of the CPU, leaving the rest to a lower priority thread.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs_throttle)
+{
+	k_thread_runtime_stats_t stats;
+	uint32_t period = k_ms_to_cyc_ceil32(50);
+	uint32_t budget = period / 5;
+	uint64_t window = k_ms_to_cyc_ceil64(500);
+
+	low_prio_progress = 0U;
+
+	k_thread_create(&worker_threads[1], worker_stacks[1], STACK_SIZE,
+			cbs_low_prio, NULL, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_create(&worker_threads[0], worker_stacks[0], STACK_SIZE,
+			cbs_spinner, NULL, NULL, NULL,
+			K_HIGHEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], budget, period), 0);
+	k_thread_start(&worker_threads[0]);
+
+	k_sleep(K_MSEC(500));
+
+	k_thread_runtime_stats_get(&worker_threads[0], &stats);
+	k_thread_abort(&worker_threads[0]);
+	k_thread_abort(&worker_threads[1]);
+
+	/* 20% share, plus one budget and some tick rounding of slack */
+	zassert_true(stats.execution_cycles < window * 3 / 10,
+		     "server ran for %llu of %llu cycles",
+		     stats.execution_cycles, window);
+	zassert_true(low_prio_progress > 0U, "lower priority thread starved");
+}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 ZTEST_SUITE(suite_deadline, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <zephyr/sys/util.h>
+
+#define HELPER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define HELPER_PRIORITY K_PRIO_PREEMPT(5)
+#define HELPER_NAME "runq_helper"
+
+/* How long the test thread keeps the readied helper off the CPU */
+#define BUSY_US 2000
+
+BUILD_ASSERT(CONFIG_ZTEST_THREAD_PRIORITY < HELPER_PRIORITY,
+	     "ZTEST not higher priority than the helper thread");
+
+static struct k_thread helper_thread;
+static K_THREAD_STACK_DEFINE(helper_stack, HELPER_STACK_SIZE);
+
+static struct k_thread spinner_thread;
+static K_THREAD_STACK_DEFINE(spinner_stack, HELPER_STACK_SIZE);
+static volatile bool spinner_stop;
+
+static K_SEM_DEFINE(wake_sem, 0, 1);
+static K_SEM_DEFINE(done_sem, 0, 1);
+
+/**
+ * @brief Helper that runs once each time it is woken
+ */
+static void helper(void *p1, void *p2, void *p3)
+{
+	while (true) {
+		k_sem_take(&wake_sem, K_FOREVER);
+		k_sem_give(&done_sem);
+	}
+}
+
+/**
+ * @brief Helper that keeps the CPU until told to stop
+ */
+static void spinner(void *p1, void *p2, void *p3)
+{
+	while (!spinner_stop) {
+		/* busy */
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static uint32_t wakeups(const struct k_runq_latency_stats *stats)
+{
+	uint32_t count = 0U;
+
+	for (int i = 0; i < K_RUNQ_LATENCY_BUCKETS; i++) {
+		count += stats->buckets[i];
+	}
+
+	return count;
+}
+
+static int bucket_of(uint32_t cycles)
+{
+	return MAX(find_msb_set(cycles), 1U) - 1U;
+}
+
+/**
+ * @brief Test recording the latency of a thread kept waiting
+ *
+ * Ready the helper while the higher priority test thread busy waits, so
+ * it sits in the run queue for at least BUSY_US.  Its histogram gains
+ * exactly that one wakeup, in the bucket matching its latency.
+ */
+ZTEST(runq_latency, test_runq_latency_record)
+{
+	struct k_runq_latency_stats before;
+	struct k_runq_latency_stats after;
+	uint32_t start;
+	uint32_t elapsed;
+	uint32_t latency;
+	int bucket;
+
+	zassert_ok(k_thread_runq_latency_get(&helper_thread, &before));
+
+	start = k_cycle_get_32();
+	k_sem_give(&wake_sem);
+	k_busy_wait(BUSY_US);
+	zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+	elapsed = k_cycle_get_32() - start;
+
+	zassert_ok(k_thread_runq_latency_get(&helper_thread, &after));
+
+	zassert_equal(wakeups(&after), wakeups(&before) + 1U,
+		      "helper wakeup not recorded once");
+
+	latency = (uint32_t)(after.total - before.total);
+	zassert_true(latency >= k_us_to_cyc_floor32(BUSY_US),
+		     "latency %u shorter than the busy wait", latency);
+	zassert_true(latency <= elapsed, "latency %u longer than %u",
+		     latency, elapsed);
+
+	bucket = bucket_of(latency);
+	for (int i = 0; i < K_RUNQ_LATENCY_BUCKETS; i++) {
+		zassert_equal(after.buckets[i],
+			      before.buckets[i] + ((i == bucket) ? 1U : 0U),
+			      "bucket %d, latency %u", i, latency);
+	}
+
+	zassert_equal(after.max, MAX(before.max, latency));
+}
+
+/**
+ * @brief Test recording the latency of a preempted thread
+ *
+ * Let a spinning thread run, then preempt it by waking the test thread
+ * and keep it off the CPU for BUSY_US.  It never blocked, yet its
+ * histogram gains one entry of at least that latency when it is
+ * switched back in.
+ */
+ZTEST(runq_latency, test_runq_latency_preempted)
+{
+	struct k_runq_latency_stats before;
+	struct k_runq_latency_stats after;
+	uint32_t latency;
+
+	spinner_stop = false;
+	k_thread_create(&spinner_thread, spinner_stack,
+			K_THREAD_STACK_SIZEOF(spinner_stack), spinner,
+			NULL, NULL, NULL, HELPER_PRIORITY, 0, K_NO_WAIT);
+
+	/* The spinner runs while we sleep and is preempted when we wake */
+	k_msleep(10);
+
+	zassert_ok(k_thread_runq_latency_get(&spinner_thread, &before));
+	zassert_equal(wakeups(&before), 1U, "spinner start not recorded");
+
+	k_busy_wait(BUSY_US);
+	spinner_stop = true;
+	zassert_ok(k_sem_take(&done_sem, K_FOREVER));
+
+	/* Before joining, which switches the spinner in once more */
+	zassert_ok(k_thread_runq_latency_get(&spinner_thread, &after));
+	k_thread_join(&spinner_thread, K_FOREVER);
+
+	zassert_equal(wakeups(&after), 2U, "preemption not recorded once");
+
+	latency = (uint32_t)(after.total - before.total);
+	zassert_true(latency >= k_us_to_cyc_floor32(BUSY_US),
+		     "latency %u shorter than the busy wait", latency);
+	zassert_equal(after.max, MAX(before.max, latency));
+}
+
+/**
+ * @brief Test argument checking of k_thread_runq_latency_get()
+ */
+ZTEST(runq_latency, test_runq_latency_get_fail)
+{
+	struct k_runq_latency_stats stats;
+
+	zassert_equal(k_thread_runq_latency_get(NULL, &stats), -EINVAL);
+	zassert_equal(k_thread_runq_latency_get(&helper_thread, NULL),
+		      -EINVAL);
+}
+
+/**
+ * @brief Test the 'kernel thread latency' shell command
+ *
+ * The helper's summary line and its buckets are printed.
+ */
+ZTEST(runq_latency, test_runq_latency_shell)
+{
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	struct k_runq_latency_stats stats;
+	char expect[64];
+	const char *buf;
+	uint32_t count;
+	size_t size;
+
+	zassert_ok(k_thread_runq_latency_get(&helper_thread, &stats));
+	count = wakeups(&stats);
+	zassert_true(count > 0U, "helper never ran");
+
+	shell_backend_dummy_clear_output(sh);
+	zassert_ok(shell_execute_cmd(sh, "kernel thread latency"));
+	buf = shell_backend_dummy_get_output(sh, &size);
+
+	zassert_not_null(strstr(buf, "Ready-to-running latency"));
+
+	buf = strstr(buf, HELPER_NAME);
+	zassert_not_null(buf, "helper thread not listed");
+
+	snprintf(expect, sizeof(expect), "wakeups %u avg %u max %u cycles",
+		 count, (uint32_t)(stats.total / count), stats.max);
+	zassert_not_null(strstr(buf, expect), "missing '%s'", expect);
+
+	for (int i = 0; i < K_RUNQ_LATENCY_BUCKETS; i++) {
+		if (stats.buckets[i] == 0U) {
+			continue;
+		}
+
+		snprintf(expect, sizeof(expect), "< 2^%-2d cycles: %u", i + 1,
+			 stats.buckets[i]);
+		zassert_not_null(strstr(buf, expect), "missing '%s'", expect);
+	}
+}
+
+static void *runq_latency_setup(void)
+{
+	k_thread_create(&helper_thread, helper_stack,
+			K_THREAD_STACK_SIZEOF(helper_stack), helper,
+			NULL, NULL, NULL, HELPER_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&helper_thread, HELPER_NAME);
+
+	/* Let the helper block on its semaphore */
+	k_msleep(10);
+
+	return NULL;
+}
+
+ZTEST_SUITE(runq_latency, NULL, runq_latency_setup, NULL, NULL, NULL);
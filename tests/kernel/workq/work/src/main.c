@@ -424,6 +424,127 @@ ZTEST(work_1cpu, test_1cpu_reentrant_queue)
 	zassert_equal(coophi_counter(), 2);
 }
 
+/* Single CPU submit a batch that mixes new, already queued and running
+ * work items.
+ */
+ZTEST(work_1cpu, test_1cpu_batch_submit)
+{
+	static struct k_work new_work[2];
+	struct k_work *batch[] = {
+		&new_work[0], &common_work1, &common_work, &new_work[1],
+	};
+	int rc;
+
+	/* Reset state and use the blocking handler for the running item */
+	reset_counters();
+	k_work_init(&common_work, rel_handler);
+	k_work_init(&common_work1, counter_handler);
+	k_work_init(&new_work[0], counter_handler);
+	k_work_init(&new_work[1], counter_handler);
+
+	/* Get one item running on the cooperative queue, and another
+	 * queued behind it.
+	 */
+	rc = k_work_submit_to_queue(&coophi_queue, &common_work);
+	zassert_equal(rc, 1);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_busy_get(&common_work), K_WORK_RUNNING);
+	rc = k_work_submit_to_queue(&coophi_queue, &common_work1);
+	zassert_equal(rc, 1);
+
+	/* The queued item is left alone and the running one goes back to
+	 * the queue running it, so only the new items reach the preempt
+	 * queue.
+	 */
+	rc = k_work_submit_batch(&preempt_queue, batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, 3);
+	zassert_equal(k_work_busy_get(&common_work),
+		      K_WORK_RUNNING | K_WORK_QUEUED);
+	zassert_equal_ptr(common_work.queue, &coophi_queue);
+	zassert_equal_ptr(common_work1.queue, &coophi_queue);
+	zassert_equal_ptr(new_work[0].queue, &preempt_queue);
+	zassert_equal_ptr(new_work[1].queue, &preempt_queue);
+	zassert_equal(preempt_counter(), 0);
+
+	/* Everything is queued now, so submitting again is a no-op. */
+	rc = k_work_submit_batch(&preempt_queue, batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, 0);
+
+	/* Release the first run, then the resubmitted one. */
+	async_release();
+	zassert_true(k_work_flush(&common_work1, &work_sync));
+	zassert_equal(k_work_busy_get(&common_work), K_WORK_RUNNING);
+	async_release();
+	zassert_true(k_work_flush(&common_work, &work_sync));
+	(void)k_work_flush(&new_work[1], &work_sync);
+
+	/* Verify completion. */
+	zassert_equal(coophi_counter(), 3);
+	zassert_equal(preempt_counter(), 2);
+	rc = k_sem_take(&sync_sem, K_NO_WAIT);
+	zassert_equal(rc, 0);
+}
+
+/* Single CPU check which batch submissions fail, and what they
+ * return.
+ */
+ZTEST(work_1cpu, test_1cpu_batch_submit_rejected)
+{
+	struct k_work *batch[] = { &common_work1, &common_work };
+	int rc;
+
+	/* Reset state and use the blocking handler for the cancelled item */
+	reset_counters();
+	k_work_init(&common_work, rel_handler);
+	k_work_init(&common_work1, counter_handler);
+
+	/* An empty batch queues nothing. */
+	rc = k_work_submit_batch(&coophi_queue, NULL, 0);
+	zassert_equal(rc, 0);
+
+	/* If nothing is queued the first error is returned. */
+	rc = k_work_submit_batch(NULL, batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, -EINVAL);
+	rc = k_work_submit_batch(&not_start_queue, batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, -ENODEV);
+	zassert_equal(k_work_busy_get(&common_work), 0);
+	zassert_equal(k_work_busy_get(&common_work1), 0);
+
+	/* Start cancelling common_work while it runs. */
+	rc = k_work_submit_to_queue(&coophi_queue, &common_work);
+	zassert_equal(rc, 1);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_cancel(&common_work),
+		      K_WORK_RUNNING | K_WORK_CANCELING);
+
+	rc = k_work_submit_batch(&coophi_queue, &batch[1], 1);
+	zassert_equal(rc, -EBUSY);
+
+	/* A skipped item doesn't stop the others, nor hide their count. */
+	rc = k_work_submit_batch(&coophi_queue, batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, 1);
+	zassert_equal(k_work_busy_get(&common_work),
+		      K_WORK_RUNNING | K_WORK_CANCELING);
+	zassert_equal(k_work_busy_get(&common_work1), K_WORK_QUEUED);
+
+	/* Already queued items are neither counted nor errors. */
+	rc = k_work_submit_batch(&coophi_queue, batch, 1);
+	zassert_equal(rc, 0);
+
+	/* The cooperative queue runs common_work1 right after the
+	 * cancelled item completes.
+	 */
+	async_release();
+	zassert_true(k_work_cancel_sync(&common_work, &work_sync));
+	zassert_false(k_work_flush(&common_work1, &work_sync));
+
+	/* Verify completion. */
+	zassert_equal(coophi_counter(), 2);
+	zassert_equal(k_work_busy_get(&common_work), 0);
+	rc = k_sem_take(&sync_sem, K_NO_WAIT);
+	zassert_equal(rc, 0);
+}
+
 /* Single CPU submit two work items and wait for flush in order
  * before they get started.
  */
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 2
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIORITY K_PRIO_PREEMPT(1)
+
+/* How long a blocked worker is held before a timer releases it */
+#define RELEASE_DELAY K_MSEC(10)
+
+BUILD_ASSERT(CONFIG_ZTEST_THREAD_PRIORITY < WORKER_PRIORITY,
+	     "ZTEST not higher priority than the pool workers");
+
+K_WORK_POOL_DEFINE(test_pool, NUM_WORKERS, STACK_SIZE);
+
+/* An item records the worker that ran it last.  If blocking, its
+ * handler waits for the item's semaphore to be given.
+ */
+struct test_item {
+	struct k_work work;
+	struct k_sem block;
+	bool blocking;
+	k_tid_t thread;
+	atomic_t runs;
+};
+
+static struct test_item items[4];
+
+/* Given by every handler once it is done. */
+static K_SEM_DEFINE(done_sem, 0, ARRAY_SIZE(items));
+
+/* Work synchronization objects must be in cache-coherent memory,
+ * which excludes stacks on some architectures.
+ */
+static struct k_work_sync work_sync;
+
+static struct k_timer release_timer;
+
+static void item_handler(struct k_work *work)
+{
+	struct test_item *item = CONTAINER_OF(work, struct test_item, work);
+
+	item->thread = k_current_get();
+
+	if (item->blocking) {
+		zassert_equal(k_sem_take(&item->block, K_FOREVER), 0);
+	}
+
+	atomic_inc(&item->runs);
+	k_sem_give(&done_sem);
+}
+
+static void release_handler(struct k_timer *timer)
+{
+	struct test_item *item = k_timer_user_data_get(timer);
+
+	k_sem_give(&item->block);
+}
+
+/* Release a blocked item from ISR context while the test thread is
+ * waiting on something else.
+ */
+static void release_later(struct test_item *item)
+{
+	k_timer_user_data_set(&release_timer, item);
+	k_timer_start(&release_timer, RELEASE_DELAY, K_NO_WAIT);
+}
+
+static k_tid_t worker(int i)
+{
+	return k_work_queue_thread_get(&test_pool.queues[i]);
+}
+
+/* Wait until an item has started running */
+static void wait_running(struct test_item *item)
+{
+	while (!(k_work_busy_get(&item->work) & K_WORK_RUNNING)) {
+		k_sleep(K_MSEC(1));
+	}
+}
+
+/* Occupy both workers with blocking items 0 and 1. */
+static void block_workers(void)
+{
+	items[0].blocking = true;
+	items[1].blocking = true;
+
+	zassert_equal(k_work_pool_submit(&test_pool, &items[0].work), 1);
+	zassert_equal(k_work_pool_submit(&test_pool, &items[1].work), 1);
+
+	wait_running(&items[0]);
+	wait_running(&items[1]);
+
+	zassert_not_equal(items[0].thread, items[1].thread,
+			  "idle workers not used");
+}
+
+/* The blocking item running on a worker, see block_workers() */
+static struct test_item *blocker_on(struct k_work_q *queue)
+{
+	return (items[0].work.queue == queue) ? &items[0] : &items[1];
+}
+
+/* A worker that runs out of work takes the items queued behind a busy
+ * one, but not an item resubmitted while running.
+ */
+ZTEST(work_pool, test_steal)
+{
+	struct test_item *owner;
+	struct test_item *other;
+	k_tid_t owner_thread;
+
+	block_workers();
+
+	/* No worker is idle, item 2 waits behind one of them */
+	zassert_equal(k_work_pool_submit(&test_pool, &items[2].work), 1);
+	owner = blocker_on(items[2].work.queue);
+	other = (owner == &items[0]) ? &items[1] : &items[0];
+	owner_thread = owner->thread;
+
+	k_sem_give(&other->block);
+	zassert_equal(k_sem_take(&done_sem, K_FOREVER), 0);
+	zassert_equal(k_sem_take(&done_sem, K_FOREVER), 0);
+
+	zassert_equal(atomic_get(&items[2].runs), 1);
+	zassert_equal(items[2].thread, other->thread,
+		      "item queued behind a busy worker not stolen");
+	zassert_equal(atomic_get(&owner->runs), 0);
+
+	zassert_equal(k_work_pool_submit(&test_pool, &owner->work), 2);
+
+	k_sem_give(&owner->block);
+	zassert_equal(k_sem_take(&done_sem, K_FOREVER), 0);
+
+	k_sem_give(&owner->block);
+	zassert_true(k_work_flush(&owner->work, &work_sync));
+
+	zassert_equal(atomic_get(&owner->runs), 2);
+	zassert_equal(owner->thread, owner_thread,
+		      "resubmitted item ran on another worker");
+}
+
+/* Flushing an item that is stolen waits for it on the worker that runs
+ * it.
+ */
+ZTEST(work_pool, test_flush_stolen)
+{
+	struct test_item *owner;
+	struct test_item *other;
+
+	block_workers();
+
+	zassert_equal(k_work_pool_submit(&test_pool, &items[2].work), 1);
+	owner = blocker_on(items[2].work.queue);
+	other = (owner == &items[0]) ? &items[1] : &items[0];
+
+	/* The other worker steals item 2 along with the flusher */
+	release_later(other);
+
+	zassert_true(k_work_flush(&items[2].work, &work_sync));
+	zassert_equal(atomic_get(&items[2].runs), 1);
+	zassert_equal(items[2].thread, other->thread);
+	zassert_equal(atomic_get(&owner->runs), 0,
+		      "flush waited for the worker item 2 was queued to");
+
+	k_sem_give(&owner->block);
+	zassert_true(k_work_flush(&owner->work, &work_sync));
+}
+
+ZTEST(work_pool, test_cancel_sync)
+{
+	block_workers();
+
+	/* A pending item is cancelled without running */
+	zassert_equal(k_work_pool_submit(&test_pool, &items[2].work), 1);
+	zassert_true(k_work_cancel_sync(&items[2].work, &work_sync));
+	zassert_equal(k_work_busy_get(&items[2].work), 0);
+
+	/* A running item is waited for */
+	release_later(&items[0]);
+	zassert_true(k_work_cancel_sync(&items[0].work, &work_sync));
+	zassert_equal(atomic_get(&items[0].runs), 1);
+
+	k_sem_give(&items[1].block);
+	zassert_true(k_work_flush(&items[1].work, &work_sync));
+
+	zassert_equal(atomic_get(&items[2].runs), 0);
+	zassert_false(k_work_cancel_sync(&items[2].work, &work_sync));
+}
+
+/* Items only go to workers that accept them. */
+ZTEST(work_pool, test_closed_worker)
+{
+	struct k_work_q *open_queue = &test_pool.queues[1];
+
+	zassert_equal(k_work_queue_drain(&test_pool.queues[0], true), 0);
+
+	for (int i = 0; i < ARRAY_SIZE(items); i++) {
+		zassert_equal(k_work_pool_submit(&test_pool, &items[i].work),
+			      1);
+		zassert_equal_ptr(items[i].work.queue, open_queue);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(items); i++) {
+		zassert_equal(k_sem_take(&done_sem, K_FOREVER), 0);
+		zassert_equal(items[i].thread, worker(1));
+	}
+
+	zassert_equal(k_work_queue_unplug(&test_pool.queues[0]), 0);
+
+	/* A plugged pool refuses new items */
+	zassert_true(k_work_pool_drain(&test_pool, true) >= 0);
+	zassert_equal(k_work_pool_submit(&test_pool, &items[0].work), -EBUSY);
+	zassert_equal(k_work_pool_unplug(&test_pool), 0);
+	zassert_equal(k_work_pool_unplug(&test_pool), -EALREADY);
+
+	zassert_equal(k_work_pool_submit(&test_pool, &items[0].work), 1);
+	zassert_equal(k_sem_take(&done_sem, K_FOREVER), 0);
+}
+
+static void *work_pool_setup(void)
+{
+	struct k_work_pool_config cfg = {
+		.name = "test_pool",
+	};
+
+	k_timer_init(&release_timer, release_handler, NULL);
+	k_work_pool_start(&test_pool, WORKER_PRIORITY, &cfg);
+
+	return NULL;
+}
+
+static void work_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < ARRAY_SIZE(items); i++) {
+		k_work_init(&items[i].work, item_handler);
+		k_sem_init(&items[i].block, 0, 1);
+		items[i].blocking = false;
+		items[i].thread = NULL;
+		atomic_clear(&items[i].runs);
+	}
+
+	k_sem_reset(&done_sem);
+}
+
+static void work_pool_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_timer_stop(&release_timer);
+	zassert_true(k_work_pool_drain(&test_pool, false) >= 0);
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, work_pool_before,
+	    work_pool_after, NULL);
@@ -142,6 +142,118 @@ ZTEST(log_buffer, test_item_put_no_overwrite)
 	item_put_no_overwrite(false);
 }
 
+void item_claim_many(bool pow2)
+{
+	struct mpsc_pbuf_buffer buffer;
+	const union mpsc_pbuf_generic *packets[3];
+	union test_item test_1word = {.data = {.valid = 1, .len = 1 }};
+	uint32_t rd = 0;
+	uint32_t wr = 0;
+	size_t n;
+
+	init(&buffer, 8 - !pow2, false);
+
+	/* Produce and consume in uneven batches so that indexes wrap */
+	for (int i = 0; i < 4 * buffer.size; i++) {
+		while (wr - rd < (i % 5) + 1) {
+			test_1word.data.data = wr++;
+			mpsc_pbuf_put_word(&buffer, test_1word.item);
+		}
+
+		n = mpsc_pbuf_claim_many(&buffer, packets, ARRAY_SIZE(packets));
+		zassert_equal(n, MIN(wr - rd, ARRAY_SIZE(packets)));
+
+		for (size_t j = 0; j < n; j++) {
+			union test_item *t = (union test_item *)packets[j];
+
+			zassert_equal(t->data.data, rd + j);
+		}
+
+		mpsc_pbuf_free_many(&buffer, packets, n);
+		rd += n;
+	}
+
+	while (rd != wr) {
+		n = mpsc_pbuf_claim_many(&buffer, packets, ARRAY_SIZE(packets));
+		zassert_true(n > 0);
+		mpsc_pbuf_free_many(&buffer, packets, n);
+		rd += n;
+	}
+
+	zassert_equal(mpsc_pbuf_claim_many(&buffer, packets, ARRAY_SIZE(packets)), 0);
+	zassert_is_null(mpsc_pbuf_claim(&buffer));
+}
+
+ZTEST(log_buffer, test_item_claim_many)
+{
+	item_claim_many(true);
+	item_claim_many(false);
+}
+
+static uint32_t claim_many_drop_cnt;
+
+static void claim_many_drop(const struct mpsc_pbuf_buffer *buffer,
+			    const union mpsc_pbuf_generic *item)
+{
+	claim_many_drop_cnt++;
+}
+
+void item_claim_many_overwrite(bool pow2)
+{
+	struct mpsc_pbuf_buffer buffer;
+	const union mpsc_pbuf_generic *packets[3];
+	union test_item test_1word = {.data = {.valid = 1, .len = 1 }};
+	uint32_t next = 0;
+	uint32_t wr = 0;
+	uint32_t rd = 0;
+	size_t n;
+
+	init(&buffer, 8 - !pow2, true);
+	buffer.notify_drop = claim_many_drop;
+	claim_many_drop_cnt = 0;
+
+	/* Producers overwrite the buffer while a run of packets is claimed */
+	for (int i = 0; i < 4 * buffer.size; i++) {
+		for (int j = 0; j < 3; j++) {
+			test_1word.data.data = wr++;
+			mpsc_pbuf_put_word(&buffer, test_1word.item);
+		}
+
+		n = mpsc_pbuf_claim_many(&buffer, packets, ARRAY_SIZE(packets));
+		zassert_true(n > 0);
+
+		for (int j = 0; j < 3; j++) {
+			test_1word.data.data = wr++;
+			mpsc_pbuf_put_word(&buffer, test_1word.item);
+		}
+
+		for (size_t j = 0; j < n; j++) {
+			union test_item *t = (union test_item *)packets[j];
+
+			zassert_true(t->data.data >= next);
+			next = t->data.data + 1;
+		}
+
+		mpsc_pbuf_free_many(&buffer, packets, n);
+		rd += n;
+	}
+
+	while ((n = mpsc_pbuf_claim_many(&buffer, packets, ARRAY_SIZE(packets))) > 0) {
+		mpsc_pbuf_free_many(&buffer, packets, n);
+		rd += n;
+	}
+
+	/* Every packet was either consumed or reported as dropped */
+	zassert_equal(rd + claim_many_drop_cnt, wr, "rd:%d dropped:%d wr:%d",
+		      rd, claim_many_drop_cnt, wr);
+}
+
+ZTEST(log_buffer, test_item_claim_many_overwrite)
+{
+	item_claim_many_overwrite(true);
+	item_claim_many_overwrite(false);
+}
+
 void item_put_overwrite(bool pow2)
 {
 	struct mpsc_pbuf_buffer buffer;
@@ -0,0 +1,692 @@
+/* main.c - Application main entry point
+ *
+ * Tests for the software segmentation (GSO) and receive offload (GRO) of
+ * TCP. Super-segments are split by the stack and the resulting segments are
+ * caught in the send function of a DUMMY interface. Received segments are
+ * injected into the RX queue of the same interface and the packets that come
+ * out of GRO are caught by a connection handler.
+ */
+
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/linker/sections.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_ip.h>
+
+#include "ipv4.h"
+#include "ipv6.h"
+#include "connection.h"
+#include "tcp_internal.h"
+#include "net_private.h"
+#include "net_stats.h"
+
+#include <zephyr/ztest.h>
+
+#define MY_PORT 4242
+#define PEER_PORT 4243
+
+#define SEQ_BASE 1000U
+#define ACK_SEQ 2000U
+#define WINDOW 0x4000U
+
+/* Split into MSS_TX sized segments: 500, 500 and 300 bytes */
+#define MSS_TX 500U
+#define DATA_TX 1300U
+
+/* Received segments. Three of these fit into CONFIG_NET_GRO_MAX_SIZE
+ * with the IPv4 headers, four would not.
+ */
+#define MSS_RX 400U
+
+#define PAYLOAD_LEN 2048U
+
+#define ALLOC_TIMEOUT K_MSEC(500)
+#define RX_TIMEOUT K_MSEC(500)
+#define NO_RX_TIMEOUT K_MSEC(50)
+
+#define IPV4_HDR_LEN (sizeof(struct net_ipv4_hdr) + sizeof(struct tcphdr))
+#define IPV6_HDR_LEN (sizeof(struct net_ipv6_hdr) + sizeof(struct tcphdr))
+
+BUILD_ASSERT(IPV4_HDR_LEN + 3 * MSS_RX <= CONFIG_NET_GRO_MAX_SIZE);
+BUILD_ASSERT(IPV4_HDR_LEN + 4 * MSS_RX > CONFIG_NET_GRO_MAX_SIZE);
+BUILD_ASSERT(DATA_TX <= PAYLOAD_LEN && 5 * MSS_RX <= PAYLOAD_LEN);
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+static struct in6_addr my_addr_v6 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					  0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+static struct in6_addr peer_addr_v6 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					    0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+
+static uint8_t peer_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 };
+
+static struct net_if *net_iface;
+static uint8_t payload[PAYLOAD_LEN];
+
+/* Segments given to the interface for sending */
+static struct net_pkt *sent[8];
+static int sent_count;
+static bool capture;
+
+/* Index of the captured segment whose send fails, -1 for none */
+static int fail_at;
+
+/* Packets passed up to the connection */
+struct delivery {
+	size_t len;
+	uint16_t gso_size;
+	uint32_t seq;
+	uint8_t flags;
+	bool data_ok;
+};
+
+static struct delivery delivered[8];
+static int delivered_count;
+static K_SEM_DEFINE(rx_sem, 0, UINT_MAX);
+
+struct net_gso_gro_context {
+	uint8_t mac_addr[sizeof(struct net_eth_addr)];
+};
+
+static int net_gso_gro_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static void net_gso_gro_iface_init(struct net_if *iface)
+{
+	struct net_gso_gro_context *context = net_if_get_device(iface)->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	context->mac_addr[0] = 0x00;
+	context->mac_addr[1] = 0x00;
+	context->mac_addr[2] = 0x5E;
+	context->mac_addr[3] = 0x00;
+	context->mac_addr[4] = 0x53;
+	context->mac_addr[5] = 0x01;
+
+	net_if_set_link_addr(iface, context->mac_addr, 6, NET_LINK_ETHERNET);
+}
+
+static int tester_send(const struct device *dev, struct net_pkt *pkt)
+{
+	if (!pkt->buffer) {
+		return -ENODATA;
+	}
+
+	if (capture && sent_count == fail_at) {
+		return -EIO;
+	}
+
+	if (capture && sent_count < ARRAY_SIZE(sent)) {
+		sent[sent_count++] = net_pkt_ref(pkt);
+	}
+
+	return 0;
+}
+
+static struct net_gso_gro_context net_gso_gro_context_data;
+
+static struct dummy_api net_gso_gro_if_api = {
+	.iface_api.init = net_gso_gro_iface_init,
+	.send = tester_send,
+};
+
+NET_DEVICE_INIT(net_gso_gro_test, "net_gso_gro_test",
+		net_gso_gro_dev_init, NULL,
+		&net_gso_gro_context_data, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		&net_gso_gro_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), NET_IPV6_MTU);
+
+static enum net_verdict tcp_received(struct net_conn *conn,
+				     struct net_pkt *pkt,
+				     union net_ip_header *ip_hdr,
+				     union net_proto_header *proto_hdr,
+				     void *user_data)
+{
+	static uint8_t data[CONFIG_NET_GRO_MAX_SIZE];
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+			 sizeof(struct tcphdr);
+	struct delivery *d;
+	size_t data_len;
+
+	if (delivered_count < ARRAY_SIZE(delivered)) {
+		d = &delivered[delivered_count++];
+
+		d->len = net_pkt_get_len(pkt);
+		d->gso_size = net_pkt_gso_size(pkt);
+		d->seq = sys_get_be32(proto_hdr->tcp->seq);
+		d->flags = proto_hdr->tcp->flags;
+
+		/* The payload must be the stream, in order */
+		data_len = d->len - hdr_len;
+
+		net_pkt_cursor_init(pkt);
+
+		d->data_ok = d->len > hdr_len && data_len <= sizeof(data) &&
+			     d->seq - SEQ_BASE + data_len <= sizeof(payload) &&
+			     !net_pkt_skip(pkt, hdr_len) &&
+			     !net_pkt_read(pkt, data, data_len) &&
+			     !memcmp(data, payload + d->seq - SEQ_BASE, data_len);
+	}
+
+	net_pkt_unref(pkt);
+
+	k_sem_give(&rx_sem);
+
+	return NET_OK;
+}
+
+/* Build a TCP segment carrying the payload at offset, as sent by us or as
+ * received from the peer.
+ */
+static struct net_pkt *make_pkt(sa_family_t family, bool rx, size_t offset,
+				size_t len, uint8_t flags, uint16_t gso_size)
+{
+	struct tcphdr th = { 0 };
+	struct net_pkt *pkt;
+	int ret;
+
+	if (rx) {
+		pkt = net_pkt_rx_alloc_with_buffer(net_iface, sizeof(th) + len,
+						   family, IPPROTO_TCP,
+						   ALLOC_TIMEOUT);
+	} else {
+		pkt = net_pkt_alloc_with_buffer(net_iface, sizeof(th) + len,
+						family, IPPROTO_TCP,
+						ALLOC_TIMEOUT);
+	}
+
+	if (!pkt) {
+		return NULL;
+	}
+
+	if (family == AF_INET) {
+		ret = rx ? net_ipv4_create(pkt, &peer_addr, &my_addr) :
+			   net_ipv4_create(pkt, &my_addr, &peer_addr);
+	} else {
+		ret = rx ? net_ipv6_create(pkt, &peer_addr_v6, &my_addr_v6) :
+			   net_ipv6_create(pkt, &my_addr_v6, &peer_addr_v6);
+	}
+
+	if (ret < 0) {
+		goto fail;
+	}
+
+	th.th_sport = htons(rx ? PEER_PORT : MY_PORT);
+	th.th_dport = htons(rx ? MY_PORT : PEER_PORT);
+	UNALIGNED_PUT(htonl(SEQ_BASE + offset), &th.th_seq);
+	UNALIGNED_PUT(htonl(ACK_SEQ), &th.th_ack);
+	th.th_off = 5U;
+	th.th_flags = flags;
+	th.th_win = htons(WINDOW);
+
+	if (net_pkt_write(pkt, &th, sizeof(th)) ||
+	    net_pkt_write(pkt, payload + offset, len)) {
+		goto fail;
+	}
+
+	net_pkt_set_gso_size(pkt, gso_size);
+	net_pkt_cursor_init(pkt);
+
+	if (family == AF_INET) {
+		ret = net_ipv4_finalize(pkt, IPPROTO_TCP);
+	} else {
+		ret = net_ipv6_finalize(pkt, IPPROTO_TCP);
+	}
+
+	if (ret < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+
+fail:
+	net_pkt_unref(pkt);
+
+	return NULL;
+}
+
+static void verify_segment(struct net_pkt *seg, sa_family_t family,
+			   size_t offset, size_t len, uint8_t flags)
+{
+	static uint8_t data[MSS_TX];
+	size_t hdr_len = family == AF_INET ? IPV4_HDR_LEN : IPV6_HDR_LEN;
+	struct tcphdr *th;
+
+	zassert_equal(net_pkt_family(seg), family, "Wrong family");
+	zassert_equal(net_pkt_get_len(seg), hdr_len + len,
+		      "Wrong length %zu at offset %zu", net_pkt_get_len(seg),
+		      offset);
+	zassert_true(seg->buffer->len >= hdr_len, "Headers not contiguous");
+
+	if (family == AF_INET) {
+		struct net_ipv4_hdr *ipv4_hdr = NET_IPV4_HDR(seg);
+
+		zassert_equal(ntohs(ipv4_hdr->len), hdr_len + len,
+			      "Wrong IPv4 length");
+		zassert_equal(sys_get_be16(ipv4_hdr->offset) &
+			      (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK),
+			      0, "Segment was fragmented");
+		zassert_equal(net_calc_chksum_ipv4(seg), 0,
+			      "Wrong IPv4 checksum");
+	} else {
+		struct net_ipv6_hdr *ipv6_hdr = NET_IPV6_HDR(seg);
+
+		zassert_equal(ipv6_hdr->nexthdr, IPPROTO_TCP,
+			      "Segment was fragmented");
+		zassert_equal(ntohs(ipv6_hdr->len),
+			      hdr_len + len - sizeof(struct net_ipv6_hdr),
+			      "Wrong IPv6 payload length");
+	}
+
+	th = (struct tcphdr *)(seg->buffer->data + net_pkt_ip_hdr_len(seg));
+
+	zassert_equal(th_seq(th), SEQ_BASE + offset, "Wrong seq %u",
+		      th_seq(th));
+	zassert_equal(th_flags(th), flags, "Wrong flags 0x%02x at offset %zu",
+		      th_flags(th), offset);
+	zassert_equal(net_calc_chksum_tcp(seg), 0, "Wrong TCP checksum");
+
+	net_pkt_cursor_init(seg);
+	zassert_ok(net_pkt_skip(seg, hdr_len), "Cannot skip headers");
+	zassert_ok(net_pkt_read(seg, data, len), "Cannot read payload");
+	zassert_mem_equal(data, payload + offset, len, "Wrong payload");
+}
+
+static void verify_split(sa_family_t family, uint8_t flags)
+{
+	size_t offset = 0U;
+	int i;
+
+	zassert_equal(sent_count, DIV_ROUND_UP(DATA_TX, MSS_TX),
+		      "Wrong number of segments %d", sent_count);
+
+	for (i = 0; i < sent_count; i++) {
+		size_t len = MIN(DATA_TX - offset, MSS_TX);
+		bool last = i == sent_count - 1;
+
+		verify_segment(sent[i], family, offset, len,
+			       last ? flags : flags & ~(PSH | FIN));
+		offset += len;
+	}
+}
+
+static void test_gso_split(sa_family_t family)
+{
+	uint8_t flags = ACK | PSH | FIN;
+	net_stats_t pkts = GET_STAT(net_iface, seg_offload.gso_pkts);
+	net_stats_t segs = GET_STAT(net_iface, seg_offload.gso_segs);
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = make_pkt(family, false, 0, DATA_TX, flags, MSS_TX);
+	zassert_not_null(pkt, "Cannot create super-segment");
+
+	capture = true;
+	ret = net_gso_send(net_iface, pkt);
+	capture = false;
+
+	zassert_true(ret > 0, "Split failed (%d)", ret);
+
+	verify_split(family, flags);
+
+	zassert_equal(GET_STAT(net_iface, seg_offload.gso_pkts), pkts + 1,
+		      "Wrong GSO packet count");
+	zassert_equal(GET_STAT(net_iface, seg_offload.gso_segs),
+		      segs + sent_count, "Wrong GSO segment count");
+}
+
+ZTEST(net_gso_gro, test_gso_split_ipv4)
+{
+	test_gso_split(AF_INET);
+}
+
+ZTEST(net_gso_gro, test_gso_split_ipv6)
+{
+	test_gso_split(AF_INET6);
+}
+
+/* Once a segment went out, a later failure must not be reported as an
+ * error: the super-segment is consumed and the bytes sent are returned.
+ * A failure on the first segment leaves the packet with the caller.
+ */
+static void test_gso_partial(sa_family_t family)
+{
+	uint8_t flags = ACK | PSH;
+	net_stats_t pkts = GET_STAT(net_iface, seg_offload.gso_pkts);
+	net_stats_t segs = GET_STAT(net_iface, seg_offload.gso_segs);
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = make_pkt(family, false, 0, DATA_TX, flags, MSS_TX);
+	zassert_not_null(pkt, "Cannot create super-segment");
+
+	fail_at = 0;
+	capture = true;
+	ret = net_gso_send(net_iface, pkt);
+	capture = false;
+
+	zassert_equal(ret, -EIO, "First segment failure not reported (%d)",
+		      ret);
+	zassert_equal(sent_count, 0, "Segment sent");
+	net_pkt_unref(pkt);
+
+	pkt = make_pkt(family, false, 0, DATA_TX, flags, MSS_TX);
+	zassert_not_null(pkt, "Cannot create super-segment");
+
+	fail_at = 2;
+	capture = true;
+	ret = net_gso_send(net_iface, pkt);
+	capture = false;
+
+	zassert_true(ret > 0, "Partial send failed (%d)", ret);
+	zassert_equal(sent_count, 2, "Wrong number of segments %d",
+		      sent_count);
+	zassert_equal(ret, (int)(net_pkt_get_len(sent[0]) +
+				 net_pkt_get_len(sent[1])),
+		      "Wrong byte count %d", ret);
+
+	verify_segment(sent[0], family, 0U, MSS_TX, flags & ~PSH);
+	verify_segment(sent[1], family, MSS_TX, MSS_TX, flags & ~PSH);
+
+	zassert_equal(GET_STAT(net_iface, seg_offload.gso_pkts), pkts + 1,
+		      "Wrong GSO packet count");
+	zassert_equal(GET_STAT(net_iface, seg_offload.gso_segs), segs + 2,
+		      "Wrong GSO segment count");
+}
+
+ZTEST(net_gso_gro, test_gso_partial_ipv4)
+{
+	test_gso_partial(AF_INET);
+}
+
+ZTEST(net_gso_gro, test_gso_partial_ipv6)
+{
+	test_gso_partial(AF_INET6);
+}
+
+/* A super-segment is bigger than the MTU, it must reach GSO as it is and
+ * not be fragmented by IP on the way.
+ */
+static void test_gso_no_fragment(sa_family_t family)
+{
+	uint8_t flags = ACK | PSH;
+	struct net_pkt *pkt;
+	int i;
+
+	pkt = make_pkt(family, false, 0, DATA_TX, flags, MSS_TX);
+	zassert_not_null(pkt, "Cannot create super-segment");
+	zassert_true(net_pkt_get_len(pkt) > net_if_get_mtu(net_iface),
+		      "Super-segment fits the MTU");
+
+	net_pkt_lladdr_dst(pkt)->addr = peer_mac;
+	net_pkt_lladdr_dst(pkt)->len = sizeof(peer_mac);
+
+	capture = true;
+	zassert_ok(net_send_data(pkt), "Send failed");
+	capture = false;
+
+	verify_split(family, flags);
+
+	for (i = 0; i < sent_count; i++) {
+		zassert_true(net_pkt_get_len(sent[i]) <=
+			     net_if_get_mtu(net_iface), "Segment too big");
+	}
+}
+
+ZTEST(net_gso_gro, test_gso_no_fragment_ipv4)
+{
+	test_gso_no_fragment(AF_INET);
+}
+
+ZTEST(net_gso_gro, test_gso_no_fragment_ipv6)
+{
+	test_gso_no_fragment(AF_INET6);
+}
+
+/* A coalesced packet only carries the checksum of its first segment. */
+ZTEST(net_gso_gro, test_tcp_input_chksum)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	net_stats_t chkerr;
+	struct net_tcp_hdr *tcp_hdr;
+	struct net_pkt *pkt;
+
+	pkt = make_pkt(AF_INET, true, 0, MSS_RX, ACK, 0);
+	zassert_not_null(pkt, "Cannot create segment");
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt));
+	zassert_not_null(net_tcp_input(pkt, &tcp_access),
+			 "Valid segment dropped");
+
+	/* Break the checksum */
+	tcp_hdr = (struct net_tcp_hdr *)(pkt->buffer->data +
+					 net_pkt_ip_hdr_len(pkt));
+	tcp_hdr->chksum ^= 0x5aa5;
+
+	chkerr = GET_STAT(net_iface, tcp.chkerr);
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt));
+	zassert_is_null(net_tcp_input(pkt, &tcp_access),
+			"Corrupted segment accepted");
+	zassert_equal(GET_STAT(net_iface, tcp.chkerr), chkerr + 1,
+		      "Checksum error not counted");
+
+	/* Verified when merged already */
+	net_pkt_set_gso_size(pkt, MSS_RX);
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt));
+	zassert_not_null(net_tcp_input(pkt, &tcp_access),
+			 "Coalesced packet verified again");
+
+	net_pkt_unref(pkt);
+}
+
+static void recv_segment(sa_family_t family, size_t offset, size_t len,
+			 uint8_t flags)
+{
+	struct net_pkt *pkt;
+
+	pkt = make_pkt(family, true, offset, len, flags, 0);
+	zassert_not_null(pkt, "Cannot create segment");
+
+	/* The RX thread does not run before this thread waits */
+	zassert_ok(net_recv_data(net_iface, pkt), "Cannot receive segment");
+}
+
+static void wait_delivered(int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&rx_sem, RX_TIMEOUT),
+			   "Only %d packets passed up", i);
+	}
+
+	zassert_equal(k_sem_take(&rx_sem, NO_RX_TIMEOUT), -EAGAIN,
+		      "Too many packets passed up");
+	zassert_equal(delivered_count, count, "Wrong number of packets");
+}
+
+static void verify_delivered(int i, sa_family_t family, size_t offset,
+			     size_t len, uint16_t gso_size, uint8_t flags)
+{
+	size_t hdr_len = family == AF_INET ? IPV4_HDR_LEN : IPV6_HDR_LEN;
+	struct delivery *d = &delivered[i];
+
+	zassert_equal(d->seq, SEQ_BASE + offset, "Packet %d wrong seq %u", i,
+		      d->seq);
+	zassert_equal(d->len, hdr_len + len, "Packet %d wrong length %zu", i,
+		      d->len);
+	zassert_equal(d->gso_size, gso_size, "Packet %d wrong gso_size %u", i,
+		      d->gso_size);
+	zassert_equal(d->flags, flags, "Packet %d wrong flags 0x%02x", i,
+		      d->flags);
+	zassert_true(d->data_ok, "Packet %d wrong payload", i);
+}
+
+/* Held segments are passed up when the RX queue runs empty */
+static void test_gro_merge(sa_family_t family)
+{
+	net_stats_t pkts = GET_STAT(net_iface, seg_offload.gro_pkts);
+	net_stats_t segs = GET_STAT(net_iface, seg_offload.gro_segs);
+
+	recv_segment(family, 0, MSS_RX, ACK);
+	recv_segment(family, MSS_RX, MSS_RX, ACK);
+
+	wait_delivered(1);
+	verify_delivered(0, family, 0, 2 * MSS_RX, MSS_RX, ACK);
+
+	zassert_equal(GET_STAT(net_iface, seg_offload.gro_pkts), pkts + 1,
+		      "Wrong GRO packet count");
+	zassert_equal(GET_STAT(net_iface, seg_offload.gro_segs), segs + 2,
+		      "Wrong GRO segment count");
+}
+
+ZTEST(net_gso_gro, test_gro_merge_ipv4)
+{
+	test_gro_merge(AF_INET);
+}
+
+ZTEST(net_gso_gro, test_gro_merge_ipv6)
+{
+	test_gro_merge(AF_INET6);
+}
+
+ZTEST(net_gso_gro, test_gro_flush_psh)
+{
+	recv_segment(AF_INET, 0, MSS_RX, ACK);
+	recv_segment(AF_INET, MSS_RX, MSS_RX, ACK | PSH);
+	recv_segment(AF_INET, 2 * MSS_RX, MSS_RX, ACK);
+
+	wait_delivered(2);
+	verify_delivered(0, AF_INET, 0, 2 * MSS_RX, MSS_RX, ACK | PSH);
+	verify_delivered(1, AF_INET, 2 * MSS_RX, MSS_RX, 0, ACK);
+}
+
+ZTEST(net_gso_gro, test_gro_flush_short)
+{
+	recv_segment(AF_INET, 0, MSS_RX, ACK);
+	recv_segment(AF_INET, MSS_RX, MSS_RX / 2, ACK);
+	recv_segment(AF_INET, MSS_RX + MSS_RX / 2, MSS_RX, ACK);
+
+	wait_delivered(2);
+	verify_delivered(0, AF_INET, 0, MSS_RX + MSS_RX / 2, MSS_RX, ACK);
+	verify_delivered(1, AF_INET, MSS_RX + MSS_RX / 2, MSS_RX, 0, ACK);
+}
+
+ZTEST(net_gso_gro, test_gro_flush_max_size)
+{
+	net_stats_t pkts = GET_STAT(net_iface, seg_offload.gro_pkts);
+	net_stats_t segs = GET_STAT(net_iface, seg_offload.gro_segs);
+	int i;
+
+	for (i = 0; i < 5; i++) {
+		recv_segment(AF_INET, i * MSS_RX, MSS_RX, ACK);
+	}
+
+	wait_delivered(2);
+	verify_delivered(0, AF_INET, 0, 3 * MSS_RX, MSS_RX, ACK);
+	verify_delivered(1, AF_INET, 3 * MSS_RX, 2 * MSS_RX, MSS_RX, ACK);
+
+	zassert_equal(GET_STAT(net_iface, seg_offload.gro_pkts), pkts + 2,
+		      "Wrong GRO packet count");
+	zassert_equal(GET_STAT(net_iface, seg_offload.gro_segs), segs + 5,
+		      "Wrong GRO segment count");
+}
+
+/* A segment that is not merged must not overtake the held data */
+ZTEST(net_gso_gro, test_gro_flush_fin)
+{
+	recv_segment(AF_INET, 0, MSS_RX, ACK);
+	recv_segment(AF_INET, MSS_RX, MSS_RX, ACK);
+	recv_segment(AF_INET, 2 * MSS_RX, MSS_RX, ACK | FIN);
+
+	wait_delivered(2);
+	verify_delivered(0, AF_INET, 0, 2 * MSS_RX, MSS_RX, ACK);
+	verify_delivered(1, AF_INET, 2 * MSS_RX, MSS_RX, 0, ACK | FIN);
+}
+
+static void register_conn(sa_family_t family)
+{
+	struct net_conn_handle *handle;
+	int ret;
+
+	ret = net_conn_register(IPPROTO_TCP, family, NULL, NULL, PEER_PORT,
+				MY_PORT, NULL, tcp_received, NULL, &handle);
+	zassert_ok(ret, "Cannot register TCP handler (%d)", ret);
+}
+
+static void *setup(void)
+{
+	struct net_if_addr *ifaddr;
+	int i;
+
+	for (i = 0; i < sizeof(payload); i++) {
+		payload[i] = (uint8_t)(i ^ (i >> 8));
+	}
+
+	net_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(net_iface, "No dummy interface");
+
+	ifaddr = net_if_ipv4_addr_add(net_iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	ifaddr = net_if_ipv6_addr_add(net_iface, &my_addr_v6, NET_ADDR_MANUAL,
+				      0);
+	zassert_not_null(ifaddr, "Cannot add IPv6 address");
+
+	register_conn(AF_INET);
+	register_conn(AF_INET6);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sent_count = 0;
+	fail_at = -1;
+	delivered_count = 0;
+	k_sem_reset(&rx_sem);
+}
+
+static void after(void *fixture)
+{
+	int i;
+
+	ARG_UNUSED(fixture);
+
+	for (i = 0; i < sent_count; i++) {
+		net_pkt_unref(sent[i]);
+	}
+
+	sent_count = 0;
+}
+
+ZTEST_SUITE(net_gso_gro, NULL, setup, before, after, NULL);
@@ -1188,6 +1188,35 @@ ZTEST(net_socket_tcp, test_so_protocol)
 	test_context_cleanup();
 }
 
+/* Buffers past 64 KiB need window scaling, and are capped at the largest
+ * window shift of 14.
+ */
+static void test_large_buf(int sock, int optname)
+{
+	int optval = UINT16_MAX + 1;
+	socklen_t optlen = sizeof(optval);
+	int retval;
+	int rv;
+
+	rv = setsockopt(sock, SOL_SOCKET, optname, &optval, sizeof(optval));
+	if (!IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE)) {
+		zassert_equal(rv, -1, "setsockopt failed (%d)", rv);
+		return;
+	}
+
+	zassert_equal(rv, 0, "setsockopt failed (%d)", rv);
+	rv = getsockopt(sock, SOL_SOCKET, optname, &retval, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", rv);
+	zassert_equal(retval, optval, "getsockopt got invalid size");
+
+	optval = INT32_MAX;
+	rv = setsockopt(sock, SOL_SOCKET, optname, &optval, sizeof(optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", rv);
+	rv = getsockopt(sock, SOL_SOCKET, optname, &retval, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", rv);
+	zassert_equal(retval, UINT16_MAX << 14, "size %d not capped", retval);
+}
+
 ZTEST(net_socket_tcp, test_so_rcvbuf)
 {
 	struct sockaddr_in bind_addr4;
@@ -1218,9 +1247,7 @@ ZTEST(net_socket_tcp, test_so_rcvbuf)
 	rv = setsockopt(sock2, SOL_SOCKET, SO_RCVBUF, &optval, sizeof(optval));
 	zassert_equal(rv, -1, "setsockopt failed (%d)", rv);
 
-	optval = UINT16_MAX + 1;
-	rv = setsockopt(sock2, SOL_SOCKET, SO_RCVBUF, &optval, sizeof(optval));
-	zassert_equal(rv, -1, "setsockopt failed (%d)", rv);
+	test_large_buf(sock2, SO_RCVBUF);
 
 	test_close(sock1);
 	test_close(sock2);
@@ -1307,9 +1334,7 @@ ZTEST(net_socket_tcp, test_so_sndbuf)
 	rv = setsockopt(sock2, SOL_SOCKET, SO_SNDBUF, &optval, sizeof(optval));
 	zassert_equal(rv, -1, "setsockopt failed (%d)", rv);
 
-	optval = UINT16_MAX + 1;
-	rv = setsockopt(sock2, SOL_SOCKET, SO_RCVBUF, &optval, sizeof(optval));
-	zassert_equal(rv, -1, "setsockopt failed (%d)", rv);
+	test_large_buf(sock2, SO_SNDBUF);
 
 	test_close(sock1);
 	test_close(sock2);
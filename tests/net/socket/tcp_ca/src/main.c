@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Transfer data over the loopback interface with injected loss and delay,
+ * once for every congestion control module, and report the goodput. On a
+ * lossy link, no module may do much worse than reno.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/ztest_assert.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/loopback.h>
+
+#include "../../socket_helpers.h"
+
+#define MY_IPV4_ADDR "127.0.0.1"
+
+#define ANY_PORT 0
+#define SERVER_PORT 4242
+
+#define TCP_TEARDOWN_TIMEOUT K_SECONDS(3)
+
+#define TRANSFER_SIZE 100000
+#define TEST_PRIME 811
+
+#define TCP_SERVER_STACK_SIZE 2048
+
+/* Lowest goodput relative to reno on a lossy link, in percent. The loss
+ * pattern differs from run to run, leave some room for it.
+ */
+#define MIN_GOODPUT_PCT 50
+
+K_THREAD_STACK_DEFINE(tcp_server_stack_area, TCP_SERVER_STACK_SIZE);
+static struct k_thread tcp_server_thread_data;
+
+/* Reference first */
+static const char * const algorithms[] = { "reno", "cubic", "bbr" };
+
+static const struct {
+	const char *name;
+	float loss;
+	uint32_t delay_ms;
+} links[] = {
+	{ "clean",           0.0f,   0 },
+	{ "1% loss",         0.01f,  0 },
+	{ "20 ms",           0.0f,  20 },
+	{ "20 ms, 1% loss",  0.01f, 20 },
+};
+
+static uint16_t server_port = SERVER_PORT;
+
+static void set_link(float loss, uint32_t delay_ms)
+{
+	zassert_equal(loopback_set_packet_drop_ratio(loss), 0,
+		      "Error setting packet drop rate");
+	zassert_equal(loopback_set_packet_delay(delay_ms), 0,
+		      "Error setting packet delay");
+}
+
+/* Receive and check the transfer */
+static void tcp_server_thread(void *vps_sock, void *unused2, void *unused3)
+{
+	int *ps_sock = (int *)vps_sock;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	uint8_t buffer[512];
+	ssize_t total_received = 0;
+	ssize_t recved;
+	int new_sock;
+
+	new_sock = accept(*ps_sock, &addr, &addrlen);
+	zassert_true(new_sock >= 0, "accept failed");
+
+	while (total_received < TRANSFER_SIZE) {
+		recved = recv(new_sock, buffer,
+			      MIN(sizeof(buffer), TRANSFER_SIZE - total_received), 0);
+		zassert_true(recved > 0, "recv failed after %d bytes, errno %d",
+			     total_received, errno);
+
+		for (int i = 0; i < recved; i++) {
+			int total_idx = i + total_received;
+
+			zassert_equal(buffer[i], (total_idx * TEST_PRIME) & 0xff,
+				      "Unexpected data at %i", total_idx);
+		}
+
+		total_received += recved;
+	}
+
+	zassert_equal(close(new_sock), 0, "close failed");
+}
+
+/* Send TRANSFER_SIZE bytes with the given algorithm, return the goodput
+ * in kbit/s.
+ */
+static uint32_t transfer(const char *algorithm)
+{
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	uint8_t buffer[512];
+	ssize_t total_sent = 0;
+	int64_t start;
+	int64_t elapsed;
+	int c_sock;
+	int s_sock;
+	int rv;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, server_port++, &s_sock, &s_saddr);
+
+	rv = setsockopt(c_sock, IPPROTO_TCP, TCP_CONGESTION, algorithm,
+			strlen(algorithm));
+	zassert_equal(rv, 0, "setsockopt(%s) failed, errno %d", algorithm, errno);
+
+	zassert_equal(bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr)),
+		      0, "bind failed");
+	zassert_equal(listen(s_sock, 1), 0, "listen failed");
+
+	(void)k_thread_create(&tcp_server_thread_data, tcp_server_stack_area,
+			      K_THREAD_STACK_SIZEOF(tcp_server_stack_area),
+			      tcp_server_thread, &s_sock, NULL, NULL,
+			      k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	start = k_uptime_get();
+
+	zassert_equal(connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr)),
+		      0, "connect failed");
+
+	while (total_sent < TRANSFER_SIZE) {
+		size_t chunk_size = MIN(sizeof(buffer), TRANSFER_SIZE - total_sent);
+
+		for (int i = 0; i < chunk_size; i++) {
+			buffer[i] = ((i + total_sent) * TEST_PRIME) & 0xff;
+		}
+
+		rv = send(c_sock, buffer, chunk_size, 0);
+		zassert_true(rv > 0, "send failed after %d bytes, errno %d",
+			     total_sent, errno);
+		total_sent += rv;
+	}
+
+	zassert_equal(k_thread_join(&tcp_server_thread_data, K_SECONDS(120)), 0,
+		      "Transfer with %s did not complete", algorithm);
+
+	elapsed = MAX(k_uptime_get() - start, 1);
+
+	zassert_equal(close(s_sock), 0, "close failed");
+	zassert_equal(close(c_sock), 0, "close failed");
+
+	/* Let the connections go away before the next run */
+	set_link(0.0f, 0);
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+
+	return (uint32_t)(TRANSFER_SIZE * 8LL / elapsed);
+}
+
+ZTEST(net_socket_tcp_ca, test_congestion_option)
+{
+	char name[16];
+	socklen_t len;
+	int sock;
+	int rv;
+
+	sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(sock >= 0, "socket open failed");
+
+	len = sizeof(name);
+	rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &len);
+	zassert_equal(rv, 0, "getsockopt failed, errno %d", errno);
+	zassert_equal(strcmp(name, CONFIG_NET_TCP_CONGESTION_DEFAULT), 0,
+		      "Unexpected default %s", name);
+
+	for (int i = 0; i < ARRAY_SIZE(algorithms); i++) {
+		/* Including the terminating NUL is fine too */
+		rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, algorithms[i],
+				strlen(algorithms[i]) + 1);
+		zassert_equal(rv, 0, "setsockopt(%s) failed, errno %d",
+			      algorithms[i], errno);
+
+		len = sizeof(name);
+		rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &len);
+		zassert_equal(rv, 0, "getsockopt failed, errno %d", errno);
+		zassert_equal(strcmp(name, algorithms[i]), 0, "Got %s", name);
+	}
+
+	rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "vegas", 5);
+	zassert_equal(rv, -1, "Unknown algorithm accepted");
+	zassert_equal(errno, ENOENT, "Unexpected errno %d", errno);
+
+	zassert_equal(close(sock), 0, "close failed");
+}
+
+ZTEST(net_socket_tcp_ca, test_goodput)
+{
+	uint32_t reference = 0U;
+	uint32_t goodput;
+
+	for (int l = 0; l < ARRAY_SIZE(links); l++) {
+		for (int a = 0; a < ARRAY_SIZE(algorithms); a++) {
+			set_link(links[l].loss, links[l].delay_ms);
+
+			goodput = transfer(algorithms[a]);
+
+			TC_PRINT("%-16s %-6s %6u kbit/s\n", links[l].name,
+				 algorithms[a], goodput);
+
+			if (a == 0) {
+				reference = goodput;
+				continue;
+			}
+
+			if (links[l].loss > 0.0f) {
+				zassert_true((uint64_t)goodput * 100U >=
+					     (uint64_t)reference * MIN_GOODPUT_PCT,
+					     "%s on %s link: %u kbit/s, reno %u kbit/s",
+					     algorithms[a], links[l].name, goodput,
+					     reference);
+			}
+		}
+	}
+}
+
+static void *setup(void)
+{
+	k_thread_priority_set(k_current_get(),
+			      K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 1));
+
+	return NULL;
+}
+
+static void after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	set_link(0.0f, 0);
+}
+
+ZTEST_SUITE(net_socket_tcp_ca, NULL, setup, NULL, after, NULL);
@@ -130,6 +130,7 @@ static void handle_client_closing_test(sa_family_t af, struct tcphdr *th);
 static void handle_data_fin1_test(sa_family_t af, struct tcphdr *th);
 static void handle_data_during_fin1_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_recv_out_of_order(struct net_pkt *pkt);
+static void handle_server_sack(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -218,6 +219,14 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Make the peer put the options above into SYNs of other test cases too */
+static bool peer_syn_options;
+
+static bool syn_with_options(uint8_t flags)
+{
+	return (test_case_no == 4U || peer_syn_options) && (flags & SYN);
+}
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -231,7 +240,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
-	if ((test_case_no == 4U) && (flags & SYN)) {
+	if (syn_with_options(flags)) {
 		opts_len = sizeof(tcp_options);
 	}
 
@@ -267,7 +276,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == 4U) && (flags & SYN)) {
+	if (syn_with_options(flags)) {
 		th->th_off = 10U;
 	} else {
 		th->th_off = 5U;
@@ -286,7 +295,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == 4U) && (flags & SYN)) {
+	if (syn_with_options(flags)) {
 		/* Add TCP Options */
 		ret = net_pkt_write(pkt, tcp_options, opts_len);
 		if (ret < 0) {
@@ -441,6 +450,9 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case 12:
 		handle_syn_rst_ack(net_pkt_family(pkt), &th);
 		break;
+	case 13:
+		handle_server_sack(pkt);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -1884,4 +1896,180 @@ ZTEST(net_tcp, test_server_out_of_order_data)
 	test_server_timeout_out_of_order_data();
 }
 
+static void close_with_rst(struct net_context *ctx)
+{
+	struct net_pkt *rst;
+	int ret;
+
+	rst = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+/* The peer offers a window shift of 7 in its SYN, so every window it
+ * advertises after the handshake must be scaled.
+ */
+ZTEST(net_tcp, test_server_window_scale)
+{
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE)) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	peer_syn_options = true;
+	ctx = create_server_socket(0, 0);
+	peer_syn_options = false;
+
+	conn = accepted_ctx->tcp;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	zassert_equal(conn->snd_wscale, 7, "Peer window shift not used");
+	zassert_equal(conn->rcv_wscale, 0,
+		      "Receive window fits 16 bits, no shift expected");
+#endif
+	zassert_equal(conn->send_win,
+		      MIN((uint32_t)ntohs(NET_IPV6_MTU) << 7, conn->send_win_max),
+		      "Send window %u not scaled", conn->send_win);
+
+	close_with_rst(ctx);
+}
+
+#define SACK_SEQ_INIT 1000
+static struct tcp_sack_block expected_sack;
+static bool expect_sack;
+
+static bool read_sack_option(struct net_pkt *pkt, struct tcphdr *th,
+			     struct tcp_sack_block *block)
+{
+	uint8_t opts[40];
+	size_t len = (th->th_off - 5) * 4;
+	size_t i = 0;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			 net_pkt_ip_opts_len(pkt) + sizeof(struct tcphdr)) < 0 ||
+	    net_pkt_read(pkt, opts, len) < 0) {
+		zassert_true(false, "Cannot read TCP options");
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	while (i < len && opts[i] != NET_TCP_END_OPT) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (opts[i] == NET_TCP_SACK_OPT) {
+			block->left = sys_get_be32(&opts[i + 2]);
+			block->right = sys_get_be32(&opts[i + 6]);
+			return true;
+		}
+
+		i += opts[i + 1];
+	}
+
+	return false;
+}
+
+static void handle_server_sack(struct net_pkt *pkt)
+{
+	struct tcp_sack_block block;
+	struct tcphdr th;
+	bool found;
+
+	zassert_ok(read_tcp_header(pkt, &th), "Cannot read TCP header");
+
+	zassert_equal(expected_ack, ntohl(th.th_ack),
+		      "Expected ACK %u but got %u",
+		      expected_ack, ntohl(th.th_ack));
+
+	found = read_sack_option(pkt, &th, &block);
+	zassert_equal(found, expect_sack, "SACK option %s",
+		      found ? "not expected" : "missing");
+
+	if (found) {
+		zassert_equal(block.left, expected_sack.left,
+			      "SACK left edge %u, expected %u",
+			      block.left, expected_sack.left);
+		zassert_equal(block.right, expected_sack.right,
+			      "SACK right edge %u, expected %u",
+			      block.right, expected_sack.right);
+	}
+
+	test_sem_give();
+}
+
+static void send_sack_data(uint32_t base, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	seq = base + offset;
+	pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+				  &lorem_ipsum[offset], len);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(1000), __LINE__);
+}
+
+/* Out-of-order data held in the receive queue is reported in a SACK
+ * block until the hole in front of it is filled.
+ */
+ZTEST(net_tcp, test_server_sack)
+{
+	const uint32_t base = SACK_SEQ_INIT + 1;
+	struct net_context *ctx;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK) ||
+	    CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	peer_syn_options = true;
+	ctx = create_server_socket(SACK_SEQ_INIT, 0);
+	peer_syn_options = false;
+
+#ifdef CONFIG_NET_TCP_SACK
+	zassert_true(accepted_ctx->tcp->sack_ok, "SACK not negotiated");
+#endif
+
+	test_case_no = 13;
+	expected_ack = base;
+	expect_sack = true;
+
+	expected_sack.left = base + 10;
+	expected_sack.right = base + 20;
+	send_sack_data(base, 10, 10);
+
+	expected_sack.right = base + 30;
+	send_sack_data(base, 20, 10);
+
+	/* Filling the hole acknowledges everything, no SACK any more */
+	expected_ack = base + 30;
+	expect_sack = false;
+	send_sack_data(base, 0, 10);
+
+	seq = expected_ack;
+	close_with_rst(ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -671,4 +671,32 @@ ZTEST(udp_fn_tests, test_udp)
 	zassert_false(test_failed, "udp tests failed");
 }
 
+ZTEST(udp_fn_tests, test_udp_handler_recycling)
+{
+	struct net_conn_handle *handlers[CONFIG_NET_MAX_CONN / 2];
+	struct sockaddr_in peer_addr4 = {
+		.sin_family = AF_INET,
+		.sin_addr = { { { 192, 0, 2, 9 } } },
+	};
+	int ret;
+
+	/* Unregistered handlers are only reused after a grace period, make
+	 * sure it does not leave the pool empty.
+	 */
+	for (int round = 0; round < 8; round++) {
+		for (int i = 0; i < ARRAY_SIZE(handlers); i++) {
+			ret = net_udp_register(AF_INET,
+					       (i & 1) ? (struct sockaddr *)&peer_addr4 : NULL,
+					       NULL, (i & 1) ? 1234 : 0, 5000 + i,
+					       NULL, test_fail, NULL, &handlers[i]);
+			zassert_equal(ret, 0, "round %d handler %d: %d", round, i, ret);
+		}
+
+		for (int i = 0; i < ARRAY_SIZE(handlers); i++) {
+			zassert_ok(net_udp_unregister(handlers[i]));
+			zassert_equal(net_udp_unregister(handlers[i]), -ENOENT);
+		}
+	}
+}
+
 ZTEST_SUITE(udp_fn_tests, NULL, NULL, NULL, NULL, NULL);
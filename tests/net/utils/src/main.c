@@ -921,6 +921,17 @@ ZTEST(test_utils_fn, test_ip_checksum)
 				      "Mismatch between reference and calculated checksum 3\n");
 		}
 	}
+
+	/* Long blocks from every alignment, through the word and vector loops */
+	for (int offset = 0; offset < 16; offset++) {
+		for (int length = 32; length < CHECKSUM_TEST_LENGTH - 16; length += 37) {
+			sum_got = calc_chksum_ref(length ^ 0x4d2c, testdata + offset, length);
+			sum_exp = calc_chksum(length ^ 0x4d2c, testdata + offset, length);
+
+			zassert_equal(sum_got, sum_exp,
+				      "Mismatch between reference and calculated checksum 4\n");
+		}
+	}
 }
 
 ZTEST_SUITE(test_utils_fn, NULL, NULL, NULL, NULL, NULL);
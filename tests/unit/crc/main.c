@@ -11,6 +11,9 @@
 #include "../../../lib/crc/crc32_sw.c"
 #include "../../../lib/crc/crc32c_sw.c"
 #include "../../../lib/crc/crc7_sw.c"
+#ifdef CONFIG_CRC_SW_SLICE_BY_8
+#include "../../../lib/crc/crc_slice8_tables.c"
+#endif
 
 ZTEST(crc, test_crc32c)
 {
@@ -50,6 +53,42 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+/* Long buffers, fed whole and in pieces of odd sizes and alignments,
+ * to cover the multi-byte paths of the optimized implementations.
+ */
+ZTEST(crc, test_crc_long)
+{
+	static const size_t splits[] = { 1, 3, 8, 13, 64, 100, 1021 };
+	static uint8_t buf[1021];
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)((i * 7) ^ (i >> 3));
+	}
+
+	zassert_equal(crc32_ieee(buf, sizeof(buf)), 0x10FB2CB4);
+	zassert_equal(crc32_c(0, buf, sizeof(buf), true, true), 0x7A49104F);
+	zassert_equal(crc16_ccitt(0xffff, buf, sizeof(buf)), 0x7F15);
+
+	for (size_t s = 0; s < ARRAY_SIZE(splits); s++) {
+		uint32_t ieee = 0;
+		uint32_t c = 0;
+		uint16_t ccitt = 0xffff;
+
+		for (size_t off = 0; off < sizeof(buf); off += splits[s]) {
+			size_t len = MIN(splits[s], sizeof(buf) - off);
+
+			ieee = crc32_ieee_update(ieee, buf + off, len);
+			c = crc32_c(c, buf + off, len, off == 0,
+				    off + len == sizeof(buf));
+			ccitt = crc16_ccitt(ccitt, buf + off, len);
+		}
+
+		zassert_equal(ieee, 0x10FB2CB4, "split %zu", splits[s]);
+		zassert_equal(c, 0x7A49104F, "split %zu", splits[s]);
+		zassert_equal(ccitt, 0x7F15, "split %zu", splits[s]);
+	}
+}
+
 ZTEST(crc, test_crc16)
 {
 	uint8_t test[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };